@@ -69,6 +69,35 @@ struct Fence : Module {
 
 	int   trgChannels = 0;
 
+	/*
+		Json labels shared by all Fence instances, in order of jsonIds
+	*/
+	static constexpr const char *jsonLabel[NUM_JSONS] = {
+		"mode",					//	MODE_JSON
+
+		"rawLow",				//	LOW_RAW_JSON
+		"rawHigh",				//	HIGH_RAW_JSON
+		"rawLink",				//	LINK_RAW_JSON
+		"rawStep",				//	STEP_RAW_JSON
+
+		"qtzLow",				//	LOW_QTZ_JSON
+		"qtzHigh",				//	HIGH_QTZ_JSON
+		"qtzLink",				//	LINK_QTZ_JSON
+		"qtzStep",				//	STEP_QTZ_JSON
+
+		"shprLow",				//	LOW_SHPR_JSON
+		"shprHigh",				//	HIGH_SHPR_JSON
+		"shprLink",				//	LINK_SHPR_JSON
+		"shprStep",				//	STEP_SHPR_JSON
+
+		"lowClamped",			//	LOWCLAMPED_JSON
+		"highClamped",			//	HIGHCLAMPED_JSON
+
+		"link",					//	LINK_JSON
+		"linkDelta",			//	LINK_DELTA_JSON
+		"gate",					//	GATE_JSON
+		"style",				//	STYLE_JSON
+	};
 
 	/*
 		Variables used speed up processing
@@ -112,7 +141,7 @@ struct Fence : Module {
 			else {
 				channels = inputs[CV_INPUT].getChannels();
 				for (int i = 0; i < channels; i ++) {
-					if (OL_statePoly[CV_INPUT * POLY_CHANNELS + i] != inputs[CV_INPUT].getVoltage(i)) {
+					if (inputChanged (CV_INPUT, OL_statePoly[CV_INPUT * POLY_CHANNELS + i], inputs[CV_INPUT].getVoltage(i))) {
 						skip = false;
 						break;
 					}
@@ -134,55 +163,39 @@ struct Fence : Module {
 		setCustomChangeMaskInput (CV_INPUT, CHG_CV_IN);
 		setInPoly                (TRG_INPUT, true);
 
-		setStateTypeOutput (TRG_OUTPUT, STATE_TYPE_TRIGGER);
-		setOutPoly         (TRG_OUTPUT, true);
+		setStateTypeOutput  (TRG_OUTPUT, STATE_TYPE_TRIGGER);
+		setOutPoly          (TRG_OUTPUT, true);
+		setDemandMaskOutput (TRG_OUTPUT, DMD_FENCE);
 
 		setCustomChangeMaskInput (TRG_INPUT, CHG_TRG_IN);
 		setInPoly                (CV_INPUT, true);
 
-		setOutPoly (CV_OUTPUT, true);
+		setOutPoly          (CV_OUTPUT, true);
+		setDemandMaskOutput (CV_OUTPUT, DMD_FENCE);
 
 		setStateTypeLight (LINK_LIGHT_RGB, LIGHT_TYPE_RGB    );  
 		setStateTypeLight (MODE_LIGHT_RGB, LIGHT_TYPE_RGB    );  
+
+		setLatencyInput  (TRG_INPUT);
+		setLatencyOutput ( CV_OUTPUT);
+		setLatencyOutput (TRG_OUTPUT);
 	}
 
 	/**
 		Initialize json configuration by defining the lables used form json state variables
 	*/
 	inline void moduleInitJsonConfig () {
-
-		#pragma GCC diagnostic push 
-		#pragma GCC diagnostic ignored "-Wwrite-strings"
-
 		//
 		// Config internal Parameters not bound to a user interface object
 		//
-		setJsonLabel (       MODE_JSON, "mode");
-
-		setJsonLabel (    LOW_RAW_JSON, "rawLow");
-		setJsonLabel (   HIGH_RAW_JSON, "rawHigh");
-		setJsonLabel (   LINK_RAW_JSON, "rawLink");
-		setJsonLabel (   STEP_RAW_JSON, "rawStep");
-
-		setJsonLabel (    LOW_QTZ_JSON, "qtzLow");
-		setJsonLabel (   HIGH_QTZ_JSON, "qtzHigh");
-		setJsonLabel (   LINK_QTZ_JSON, "qtzLink");
-		setJsonLabel (   STEP_QTZ_JSON, "qtzStep");
-
-		setJsonLabel (   LOW_SHPR_JSON, "shprLow");
-		setJsonLabel (  HIGH_SHPR_JSON, "shprHigh");
-		setJsonLabel (  LINK_SHPR_JSON, "shprLink");
-		setJsonLabel (  STEP_SHPR_JSON, "shprStep");
-
-		setJsonLabel ( LOWCLAMPED_JSON, "lowClamped");
-		setJsonLabel (HIGHCLAMPED_JSON, "highClamped");
-
-		setJsonLabel (       LINK_JSON, "link");
-		setJsonLabel ( LINK_DELTA_JSON, "linkDelta");
-		setJsonLabel (       GATE_JSON, "gate");
-		setJsonLabel (      STYLE_JSON, "style");
+		setJsonLabels (jsonLabel);
+	}
 
-		#pragma GCC diagnostic pop
+	/**
+		Get the json index of a json label, -1 if unknown
+	*/
+	inline int moduleJsonIdx (const char *label) {
+		return findJsonIdx (label);
 	}
 
 	/**
@@ -206,8 +219,6 @@ struct Fence : Module {
 		or a right click initialize (reset).
 	*/
 	inline void moduleInitialize () {
-		styleChanged = true;
-
 		initializeForMode ();
 		memset (oldCvOut, 0.f, sizeof (oldCvOut));
 		memset ( oldCvIn, 0.f, sizeof ( oldCvIn));
@@ -358,24 +369,6 @@ struct Fence : Module {
 		Module specific process method called from process () in OrangeLineCommon.hpp
 	*/
 	inline void moduleProcess (const ProcessArgs &args) {
-		if (styleChanged) {
-			switch (int(getStateJson(STYLE_JSON))) {
-				case STYLE_ORANGE:
-					brightPanel->visible = false;
-					darkPanel->visible = false;
-					break;
-				case STYLE_BRIGHT:
-					brightPanel->visible = true;
-					darkPanel->visible = false;
-					break;
-				case STYLE_DARK:
-					brightPanel->visible = false;
-					darkPanel->visible = true;
-					break;
-			}
-			styleChanged = false;
-		}
-
 		bool lastWasTrigger = false;
 		
 		//
@@ -420,8 +413,15 @@ struct Fence : Module {
 			processStep = effectiveStep < minStep ? minStep : effectiveStep;
 		}
 		
+		/*
+			Nothing connected to our outputs, so nothing to fence.
+			Recalculate all channels when an output gets connected again
+		*/
+		bool demanded = demandBits & DMD_FENCE;
+		bool refresh  = change || (demandRaisedBits & DMD_FENCE);
+
 		bool inConnected = getInputConnected (CV_INPUT);
-		if (inConnected & (run || change)) {
+		if (inConnected && demanded && (run || refresh)) {
 			int channels = inputs[CV_INPUT].getChannels();
 			trgChannels = inputs[TRG_INPUT].getChannels ();
 			setOutPolyChannels(CV_OUTPUT, channels);
@@ -433,16 +433,17 @@ struct Fence : Module {
 				int trgOutPolyIdx = TRG_OUTPUT * POLY_CHANNELS + channel;
 				int cvOutPolyIdx = CV_OUTPUT * POLY_CHANNELS + channel;
 
-				if ((!trgConnected && OL_inStateChangePoly[cvInPolyIdx]) || OL_inStateChangePoly[trgInPolyIdx] || (channel >= trgChannels  &&  lastWasTrigger) || change) {
+				if ((!trgConnected && OL_inStateChangePoly[cvInPolyIdx]) || OL_inStateChangePoly[trgInPolyIdx] || (channel >= trgChannels  &&  lastWasTrigger) || refresh) {
 					cvOut = OL_statePoly[cvInPolyIdx];
 					if (channel < trgChannels) {
 						lastWasTrigger = OL_inStateChangePoly[trgInPolyIdx];
 					}
 					if (mode == MODE_QTZ_INT)
 						cvOut = quantize (cvOut);
-					if (cvOut == oldCvIn[channel] && !(OL_inStateChangePoly[trgInPolyIdx] || lastWasTrigger) && !change)
+					if (cvOut == oldCvIn[channel] && !(OL_inStateChangePoly[trgInPolyIdx] || lastWasTrigger) && !refresh)
 						continue;				
 					oldCvIn[channel]  = cvOut;
+					float cvUnfolded = cvOut;
 					if (cvOut > processHigh) {
 						if (mode == MODE_QTZ_INT) {
 							cvOut -= floor (cvOut - processHigh);
@@ -467,6 +468,8 @@ struct Fence : Module {
 								cvOut += processStep;
 						}
 					}
+					if (cvOut != cvUnfolded)
+						traceEvent (TRC_FOLD, channel, round ((cvUnfolded - cvOut) / (mode == MODE_QTZ_INT ? 1.f : processStep)));
 					if (mode == MODE_QTZ_INT && cvOut > processHigh + PRECISION) {
 						/*
 							We didn't find the same note in our range
@@ -594,6 +597,16 @@ struct Fence : Module {
 		*/
 		link = int(getStateJson (LINK_JSON));
 		mode = int(getStateJson (MODE_JSON));
+		/*
+			Only quantized cv can tolerate noise, RAW and SHPR must follow every change
+		*/
+		if (changeJson (MODE_JSON) || !initialized) {
+			float threshold = (mode == MODE_QTZ_INT ? QTZ_CHANGE_THRESHOLD : 0.f);
+			setChangeThresholdInput ( LOW_INPUT, threshold);
+			setChangeThresholdInput (HIGH_INPUT, threshold);
+			setChangeThresholdInput (STEP_INPUT, threshold);
+			setChangeThresholdInput (  CV_INPUT, threshold);
+		}
 		/*
 			Check gate button
 		*/
@@ -814,6 +827,8 @@ struct Fence : Module {
 	}
 };
 
+constexpr const char *Fence::jsonLabel[NUM_JSONS];
+
 // ********************************************************************************************************************************
 /*
 	Module widget implementation
@@ -821,8 +836,9 @@ struct Fence : Module {
 
 /**
 	Widget to display cvOct values as floats or notes
+	Cached in a framebuffer, only redrawn when value, mode or style change
 */
-struct VOctWidget : TransparentWidget {
+struct VOctWidget : FramebufferWidget {
 
 	static constexpr const char*  notes = "CCDDEFFGGAAB";
 	static constexpr const char* sharps = " # #  # # # ";
@@ -837,13 +853,22 @@ struct VOctWidget : TransparentWidget {
 
 	Fence *module;
 
+	CachedContent<VOctWidget> *content;
+	float  lastValue = NAN;
+	float  lastMode  = NAN;
+	float  lastStyle = NAN;
+
 	/**
 		Constructor
 	*/
 	VOctWidget() {
 		box.size = mm2px (Vec(26, 7));
-		pFont = APP->window->loadFont(asset::plugin(pluginInstance, "res/repetition-scrolling.regular.ttf"));
+		pFont = orangeLineFont ();
 		module = nullptr;
+		content = new CachedContent<VOctWidget> ();
+		content->owner = this;
+		content->box.size = box.size;
+		addChild (content);
 	}
 	/**
 		Static function to convert a cv to a string and writes it to the
@@ -880,7 +905,7 @@ struct VOctWidget : TransparentWidget {
 		return pStr;
 	}
 
-	void draw (const DrawArgs &drawArgs) override {
+	void step () override {
 		/*
 			Knob rescale hack
 		*/
@@ -888,19 +913,29 @@ struct VOctWidget : TransparentWidget {
 			module->knobFake = false;
 			module->knobFakeResetCnt = KNOB_FAKE_STEPS;
 		}
-		nvgFontFaceId (drawArgs.vg, pFont->handle);
-		nvgFontSize (drawArgs.vg, 18);
-		nvgFillColor (drawArgs.vg, (module != nullptr ? module->getTextColor () : ORANGE));
-
 		float value = pValue != NULL ? *pValue : defaultValue;
 		float mode  = pMode  != NULL ? *pMode  : DEFAULT_MODE;
+		float style = module != nullptr ? module->getStateJson (STYLE_JSON) : STYLE_ORANGE;
+		if (value != lastValue || mode != lastMode || style != lastStyle) {
+			lastValue = value;
+			lastMode  = mode;
+			lastStyle = style;
+			dirty = true;
+		}
+		FramebufferWidget::step ();
+	}
+
+	void drawContent (const DrawArgs &drawArgs) {
+		nvgFontFaceId (drawArgs.vg, pFont->handle);
+		nvgFontSize (drawArgs.vg, 18);
+		nvgFillColor (drawArgs.vg, lastStyle == STYLE_ORANGE ? ORANGE : WHITE);
 
 		float xOffset = 0;
-		if (mode == MODE_QTZ) {
+		if (lastMode == MODE_QTZ) {
 			xOffset = mm2px (2.25);
 		}
 
-		nvgText (drawArgs.vg, xOffset, 0, cv2Str (str, value, mode, type), NULL);
+		nvgText (drawArgs.vg, xOffset, TEXT_BASELINE, cv2Str (str, lastValue, lastMode, type), NULL);
 	}
 };
 
@@ -916,6 +951,7 @@ struct FenceWidget : ModuleWidget {
 		VOctWidget *w = new VOctWidget ();
 
 		w->box.pos = pos;
+		w->box.pos.y -= TEXT_BASELINE;
 		w->pValue = pValue;
 		w->defaultValue = defaultValue;
 		w->pMode = pMode;
@@ -928,19 +964,15 @@ struct FenceWidget : ModuleWidget {
 	FenceWidget(Fence *module) {
 
 		setModule (module);
+#if OL_TRACE
+		if (module)
+			addChild (new TraceWidget (module, &module->OL_traceRing, "Fence"));
+#endif
 		setPanel (APP->window->loadSvg(asset::plugin (pluginInstance, "res/Fence.svg")));
 
 		if (module) {
-			SvgPanel *brightPanel = new SvgPanel();
-			brightPanel->setBackground(APP->window->loadSvg(asset::plugin(pluginInstance, "res/FenceBright.svg")));
-			brightPanel->visible = false;
-			module->brightPanel = brightPanel;
-			addChild(brightPanel);
-			SvgPanel *darkPanel = new SvgPanel();
-			darkPanel->setBackground(APP->window->loadSvg(asset::plugin(pluginInstance, "res/FenceDark.svg")));
-			darkPanel->visible = false;
-			module->darkPanel = darkPanel;
-			addChild(darkPanel);
+			addChild (StylePanel::create (box.size, &module->getStateJson (STYLE_JSON), STYLE_BRIGHT, "res/FenceBright.svg"));
+			addChild (StylePanel::create (box.size, &module->getStateJson (STYLE_JSON), STYLE_DARK,   "res/FenceDark.svg"));
 		}
 
 		addParam (createParamCentered<RoundBlackKnob>		(mm2px (Vec ( 3.276 + 5,    128.5 - 92.970 - 5)),    module, LOW_PARAM));
@@ -991,7 +1023,6 @@ struct FenceWidget : ModuleWidget {
 		int style;
 		void onAction(const event::Action &e) override {
 			module->OL_setOutState(STYLE_JSON, float(style));
-			module->styleChanged = true;
 		}
 		void step() override {
 			if (module)
@@ -51,6 +51,12 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #define CHG_CV_IN		1
 #define CHG_TRG_IN		(1 << 1)
+
+#define QTZ_CHANGE_THRESHOLD 0.001f	// 1 mV, far below a semitone, ignores noise on cv inputs in QTZ mode
+
+#define DMD_FENCE		1		// Fencing cvIn, feeds CV_OUTPUT and TRG_OUTPUT
+
+#define TRC_FOLD		1		// cvIn folded into the range, value = number of folds, negative when folded up
 //
 // Value Ranges
 //
@@ -25,6 +25,27 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include "Mother.hpp"
 
+/*
+	Degree tables over all note masks, built once at startup
+*/
+struct DegreeTables {
+	unsigned char count[NUM_MASKS];					//	Number of notes on
+	unsigned char select[NUM_MASKS][NUM_NOTES];		//	Note of the n-th note on, NUM_NOTES if there is none
+
+	DegreeTables () {
+		for (int mask = 0; mask < NUM_MASKS; mask++) {
+			int n = 0;
+			for (int note = 0; note < NUM_NOTES; note++)
+				if (mask & (1 << note))
+					select[mask][n++] = note;
+			count[mask] = n;
+			while (n < NUM_NOTES)
+				select[mask][n++] = NUM_NOTES;
+		}
+	}
+};
+static const DegreeTables degreeTables;
+
 struct Mother : Module {
 
 	#include "OrangeLineCommon.hpp"
@@ -43,8 +64,8 @@ struct Mother : Module {
 	char rootText[3];
 	char childText[3];
 
-	const char *notes[NUM_NOTES] = { "C", "C#", "D", "D#", "E", "F", "F#", "G", "G#", "A", "A#", "B" };
-	const char *interval = "0123456789ABO";
+	static constexpr const char *notes[NUM_NOTES] = { "C", "C#", "D", "D#", "E", "F", "F#", "G", "G#", "A", "A#", "B" };
+	static constexpr const char *interval = "0123456789ABO";
 	
 	int	effectiveRoot  = 0;
 	int	effectiveScale = 0;
@@ -52,7 +73,77 @@ struct Mother : Module {
 	int	effectiveChild = 0;
 	int	jsonOnOffBaseIdx = ONOFF_JSON;
 	int	jsonWeightBaseIdx = WEIGHT_JSON;
-	float	motherWeights[NUM_NOTES];
+	/*
+		Scale, child and root per poly channel, channel 0 is shown on the panel (effectiveScale, ...)
+	*/
+	int	channelScale[POLY_CHANNELS] = {};
+	int	channelChild[POLY_CHANNELS] = {};
+	int	channelRoot [POLY_CHANNELS] = {};
+	int	keyInputChannels = 0;		//	Channels of SCL, CHLD and ROOT input to detect added channels
+	bool	keysPending = false;		//	Resolve channels again, on/off changed
+	/*
+		Effective fate search state per note of a scale and child
+	*/
+	struct FateNotes {
+		unsigned long epoch = 0;	//	Unique per calculation, identifies the state in the fate search cache
+		bool	on[NUM_NOTES];		//	Note is on in the scale
+		float	weight[NUM_NOTES];	//	Weight after DNA rule
+		bool	mother[NUM_NOTES];	//	Weight inherited from mother scale (DNA)
+		bool	grab[NUM_NOTES];	//	Weight grabs the note (GRAB)
+		int	noteIdx[NUM_NOTES];	//	Note index relative to the child
+	};
+	/*
+		Derived state per scale and child, so switching scale or child by cv is a lookup.
+		Only valid if version matches scaleVersion of the scale, edits of the scale increment it.
+		The fate notes also depend on the weights of the child and the DNA and GRAB options, fateVersion
+	*/
+	struct ScaleChildState {
+		unsigned long version = 0;
+		float	motherWeights[NUM_NOTES];		//	Weights of the mother scale mapped to the child degrees (DNA)
+		char	headText[MAX_TEXT_SIZE + 1];	//	Scale name or interval string
+		unsigned long fateVersion = 0;
+		FateNotes notes;
+	};
+	ScaleChildState scaleChildStates[NUM_SCALES][NUM_CHLD];
+	unsigned long	scaleVersion[NUM_SCALES] = {};
+	unsigned long	fateVersion = 1;
+	FateNotes	*fateNotes = &scaleChildStates[0][0].notes;	//	Fate notes of the panel's scale and child
+	/*
+		Note light colors by note index relative to the child, see setNoteLights ()
+	*/
+	int	restColors[NUM_NOTES];		//	Weight, DNA and GRAB display
+	int	visualColors[NUM_NOTES];	//	Visualization of the last trigger
+	bool	visualColorsPending = true;
+	unsigned long restColorsEpoch = 0;
+	int	fateColors[NUM_NOTES];		//	Fate amount and shape display
+	float	fateColorsAmt = -1.f;
+	float	fateColorsShp = -1.f;
+	/*
+		Cache of fate search results by cv in
+	*/
+	struct FateCandidates {
+		unsigned long epoch = 0;	//	Valid if equal to the epoch of the fate notes searched
+		uint32_t bits;				//	Bits of cv in
+		float	semiAmt;
+		float	shp;
+		int	pCnt;
+		float	pTotal;
+		bool	grab;
+		float	pCvOut[NUM_NOTES];
+		float	pProb[NUM_NOTES];
+		float	aliasProb[NUM_NOTES];	//	Alias table for O(1) sampling, see buildAliasTable ()
+		int	alias[NUM_NOTES];
+		float	pNoteIdx[NUM_NOTES];
+		bool	pMother[NUM_NOTES];
+		float	cvOut;					//	State the search ended in, used if no candidate was found
+		float	weight;
+		float	noteIdx;
+		bool	fromMother;
+	};
+	FateCandidates fateCache[FATE_CACHE_SIZE];
+	float	fateShape[FATE_SHAPE_SIZE + 2];	//	1 - x**n over x = 0..1, one extra entry for interpolation at x = 1
+	float	fateShapeShp = -1.f;			//	Shape the table was built for
+	unsigned long  fateEpoch = 1;	//	Next epoch of fate notes
 	float	pCvOut[NUM_NOTES];
 	float	pProb[NUM_NOTES];
 	bool	pMother[NUM_NOTES];
@@ -69,7 +160,7 @@ struct Mother : Module {
 	int	channels = 0;
 	float	oldCvOut[POLY_CHANNELS];	//	Old value of cvOut to detect changes for triggering trgOut
 	float	oldCvIn [POLY_CHANNELS];	//	Old value of cvOut to detect changes of quantized input
-	int	headScrollTimer = 0;
+	unsigned long headTextVersion = 0;	//	Incremented when a new head text should scroll from its start
 
 	bool	headClick;
 	int	scaleSelected = -1;
@@ -79,10 +170,39 @@ struct Mother : Module {
 	bool	cBasedDisplayChanged = false;
 	bool	disableGrabChanged = false;
 	bool	disableDnaChanged = false;
+	bool	noteLightsPending = false;
+	bool	wasVisualizing = false;
 		
 	#include "MotherJsonLabels.hpp"
 	#include "MotherScales.hpp"
 
+	/*
+		Known scales as note masks, parsed once from scaleKeys
+	*/
+	struct ScaleTables {
+		int mask[SCALE_KEYS];			//	Notes of the known scale, bit n is note n
+		signed char key[NUM_MASKS];		//	Known scale of a note mask, -1 if there is none
+
+		ScaleTables () {
+			memset (key, -1, sizeof (key));
+			for (int k = 0; k < SCALE_KEYS; k++) {
+				int note = 0;
+				mask[k] = 1;
+				for (const char *p = scaleKeys[k]; *p != '\0'; p++) {
+					note += *p - '0';
+					if (note < NUM_NOTES)
+						mask[k] |= 1 << note;
+				}
+				if (note == NUM_NOTES && key[mask[k]] < 0)
+					key[mask[k]] = k;
+			}
+		}
+	};
+	static const ScaleTables &scaleTables () {
+		static const ScaleTables tables;
+		return tables;
+	}
+
 // ********************************************************************************************************************************
 /*
 	Initialization
@@ -114,7 +234,7 @@ struct Mother : Module {
 			else {
 				channels = inputs[CV_INPUT].getChannels();
 				for (int i = 0; i < channels; i ++) {
-					if (OL_statePoly[CV_INPUT * POLY_CHANNELS + i] != inputs[CV_INPUT].getVoltage(i)) {
+					if (inputChanged (CV_INPUT, OL_statePoly[CV_INPUT * POLY_CHANNELS + i], inputs[CV_INPUT].getVoltage(i))) {
 						skip = false;
 						break;
 					}
@@ -136,8 +256,16 @@ struct Mother : Module {
 		setInPoly                (TRG_INPUT, true);
 
 		setCustomChangeMaskInput (CV_INPUT, CHG_CV_IN);
+		setChangeThresholdInput  (CV_INPUT, CV_CHANGE_THRESHOLD);
 		setInPoly                (CV_INPUT, true);
 
+		setChangeThresholdInput ( SCL_INPUT, CV_CHANGE_THRESHOLD);
+		setInPoly                ( SCL_INPUT, true);
+		setChangeThresholdInput (CHLD_INPUT, CV_CHANGE_THRESHOLD);
+		setInPoly                (CHLD_INPUT, true);
+		setChangeThresholdInput (ROOT_INPUT, CV_CHANGE_THRESHOLD);
+		setInPoly                (ROOT_INPUT, true);
+
 		setInPoly          (RND_INPUT, true);
 
      	setStateTypeOutput (GATE_OUTPUT, STATE_TYPE_TRIGGER);
@@ -145,22 +273,34 @@ struct Mother : Module {
 
 		setOutPoly         (CV_OUTPUT, true);
 		setOutPoly         (POW_OUTPUT, true);
+
+		setDemandMaskOutput (  CV_OUTPUT, DMD_FATE);
+		setDemandMaskOutput (GATE_OUTPUT, DMD_FATE);
+		setDemandMaskOutput ( POW_OUTPUT, DMD_FATE);
+
+		setLatencyInput  (  TRG_INPUT);
+		setLatencyOutput (  CV_OUTPUT);
+		setLatencyOutput (GATE_OUTPUT);
 	}
 
 	/**
 		Initialize json configuration by defining the lables used form json state variables
 	*/
 	inline void moduleInitJsonConfig () {
-
-		#pragma GCC diagnostic push 
-		#pragma GCC diagnostic ignored "-Wwrite-strings"
 		//
 		// Config internal Parameters not bound to a user interface object
 		//
-		for (int i = 0; i < NUM_JSONS; i ++) {
-			setJsonLabel (i, jsonLabel[i]);
-		}
-		#pragma GCC diagnostic pop
+		setJsonLabels (motherJsonLabels ());
+	}
+
+	/**
+		Get the json index of a json label, -1 if unknown
+	*/
+	inline int moduleJsonIdx (const char *label) {
+		int jsonIdx = motherJsonIdx (label);
+		if (jsonIdx < 0)
+			jsonIdx = findJsonIdx (label, ONOFF_JSON);
+		return jsonIdx;
 	}
 
 	/**
@@ -228,11 +368,14 @@ struct Mother : Module {
 		for (int i = WEIGHT_JSON; i <= WEIGHT_JSON_LAST; i ++)
 			setStateJson (i, 0.5f);
 
-		updateMotherWeights ();
+#ifdef OL_USE_FIXED_SEED
+		init_genrand (OL_FIXED_SEED);
+#else
 		struct timeval tp;
 		gettimeofday(&tp, NULL);
 		unsigned long int seed = tp.tv_sec * 1000 + tp.tv_usec / 1000;
 		init_genrand (seed);
+#endif
 		setStateJson (AUTO_CHANNELS_JSON, 1.f);
 		setStateJson (VISUALIZATION_DISABLED_JSON, 0.f);
 		setStateJson (DNA_DISABLED_JSON, 0.f);
@@ -245,30 +388,60 @@ struct Mother : Module {
 /*
 	Module specific utility methods
 */
+	/**
+		Derived state of a scale and child, recalculated only after edits of the scale
+	*/
+	ScaleChildState &scaleChildState (int scale, int child) {
+		ScaleChildState &s = scaleChildStates[scale][child];
+		if (s.version != scaleVersion[scale]) {
+			s.version = scaleVersion[scale];
+			updateMotherWeights (scale, child, s.motherWeights);
+			scaleText (scale, child, s.headText);
+			s.fateVersion = 0;
+		}
+		return s;
+	}
+
+	/**
+		Fate notes of a scale and child, recalculated only after edits
+	*/
+	FateNotes &getFateNotes (int scale, int child) {
+		ScaleChildState &s = scaleChildState (scale, child);
+		if (s.fateVersion != fateVersion) {
+			s.fateVersion = fateVersion;
+			updateFateNotes (scale, child, s);
+		}
+		return s.notes;
+	}
+
 	void setHeadScale () {
+		strcpy (headText, scaleChildState (effectiveScale, effectiveChild).headText);
+		strcpy (headDisplayText, headText);
+		headTextVersion ++;
+	}
+
+	/**
+		Name of the scale the child plays, the interval string if it is not a known scale
+	*/
+	void scaleText (int scale, int child, char *buf) {
+		int mask = onOffMask (scale);
+		int childMask = ((mask >> child) | (mask << (NUM_NOTES - child))) & (NUM_MASKS - 1);
+		int key = scaleTables ().key[childMask];
+		if (key >= 0) {
+			strcpy (buf, scaleNames[key]);
+			return;
+		}
 		int bufIdx = 0;
-		char buf[MAX_TEXT_SIZE + 1];
-		buf[0] = '\0';
-		int start = ONOFF_JSON + effectiveScale * NUM_NOTES + 1;
-		int lightIdx;
 		int i = 1;
-		for (int jsonIdx = start; jsonIdx < start + NUM_NOTES; jsonIdx ++) {
-			lightIdx = (jsonIdx - start + effectiveChild) % NUM_NOTES;
-			if (getStateJson (start + lightIdx) > 0.f) {
+		for (int note = 1; note <= NUM_NOTES; note ++) {
+			if (childMask & (1 << (note % NUM_NOTES))) {
 				buf[bufIdx] = interval[i];
 				bufIdx++;
-				buf[bufIdx] = '\0';
 				i = 0;
 			}
 			i ++;
 		}
-		for (long unsigned int i = 0; i < SCALE_KEYS; i ++) {
-			if (!strcmp (buf, scaleKeys[i]))
-				strcpy (buf, scaleNames[i]);
-		}
-		strcpy (headText, buf);
-		strcpy (headDisplayText, buf);
-		headScrollTimer = TEXT_SCROLL_PRE_DELAY;
+		buf[bufIdx] = '\0';
 	}
 
 	inline void setTmpHead (const char *tmpHead) {
@@ -302,24 +475,6 @@ struct Mother : Module {
 
 		checkTmpHead ();
 
-		if (styleChanged) {
-			switch (int(getStateJson(STYLE_JSON))) {
-				case STYLE_ORANGE:
-					brightPanel->visible = false;
-					darkPanel->visible = false;
-					break;
-				case STYLE_BRIGHT:
-					brightPanel->visible = true;
-					darkPanel->visible = false;
-					break;
-				case STYLE_DARK:
-					brightPanel->visible = false;
-					darkPanel->visible = true;
-					break;
-			}
-			styleChanged = false;
-		}
-		
 		bool rndConnected = getInputConnected (RND_INPUT);
 		bool trgConnected = getInputConnected (TRG_INPUT);
 		triggered = false;
@@ -327,14 +482,18 @@ struct Mother : Module {
 		float cvIn;
 		float semiAmt = getStateParam (FATE_AMT_PARAM) / 12.f;
 		float shp = getStateParam (FATE_SHP_PARAM);
-		float d;
-		float weight;
 		float rnd;
-		bool grab = false;
-		bool fromMother = false;
+		int pick = -1;
 		bool lastWasTrigger = false;
 
-		if ((customChangeBits & CHG_TRG_IN) || (!trgConnected && (customChangeBits & CHG_CV_IN))) {
+		/*
+			Without connected outputs the fate search only feeds the visualization.
+			In cv mode redo it when an output gets connected, so the output reflects the current cv
+		*/
+		bool demanded = (demandBits & DMD_FATE) || getStateJson (VISUALIZATION_DISABLED_JSON) == 0.f;
+		bool catchUp  = (demandRaisedBits & DMD_FATE) && !trgConnected;
+
+		if (demanded && ((customChangeBits & CHG_TRG_IN) || (!trgConnected && ((customChangeBits & CHG_CV_IN) || catchUp)))) {
 			cvChannels = inputs[CV_INPUT].getChannels ();
 			trgChannels = inputs[TRG_INPUT].getChannels ();
 			rndChannels = inputs[RND_INPUT].getChannels ();
@@ -345,9 +504,10 @@ struct Mother : Module {
 			setOutPolyChannels (CV_OUTPUT, channels);
 			setOutPolyChannels (GATE_OUTPUT, channels);
 			setOutPolyChannels (POW_OUTPUT, channels);
+			FateCandidates *candidates = nullptr;
+			int lastChannel = -1;	//	Last triggered channel, shown by the visualization
+			int lastNoteIdx = 0;
 			for (int channel = 0; channel < channels; channel++) {
-				weight = 0;
-				grab = false;
 				int cvInPolyIdx   =    CV_INPUT * POLY_CHANNELS + channel;
 				int trgInPolyIdx  =   TRG_INPUT * POLY_CHANNELS + channel;
 				int rndInPolyIdx  =   RND_INPUT * POLY_CHANNELS + channel;
@@ -355,169 +515,54 @@ struct Mother : Module {
 				int cvOutPolyIdx  =   CV_OUTPUT * POLY_CHANNELS + channel;
 				int powOutPolyIdx =  POW_OUTPUT * POLY_CHANNELS + channel;
 
-				if ((!trgConnected && OL_inStateChangePoly[cvInPolyIdx]) || OL_inStateChangePoly[trgInPolyIdx] || (channel >= trgChannels && lastWasTrigger)) {
+				if ((!trgConnected && (OL_inStateChangePoly[cvInPolyIdx] || catchUp)) || OL_inStateChangePoly[trgInPolyIdx] || (channel >= trgChannels && lastWasTrigger)) {
 					if (channel < trgChannels)
 						lastWasTrigger = OL_inStateChangePoly[trgInPolyIdx];
 
-					reflectCounter = REFLECT_DURATION;
 					if (rndConnected && channel < rndChannels)
 						init_genrand (int(round (OL_statePoly[rndInPolyIdx] * 100000)));
 
-					pCnt = 0;
-					pTotal = 0.f;
-
 					if ((OL_inStateChangePoly[trgInPolyIdx] || lastWasTrigger) && (!getInputConnected (CV_INPUT) || channel >= cvChannels))
 						cvIn = genrand_real () * 20.f - 10.f;
-					else
-						cvIn = OL_statePoly[cvInPolyIdx] - (float(effectiveRoot) / 12.f);
-					cvOut = quantize (cvIn);
-					int note = note(cvOut);
-					noteIdx = (note - effectiveChild + NUM_NOTES) % NUM_NOTES;
-					noteIdxIn = (note (cvIn) - effectiveChild + NUM_NOTES) % NUM_NOTES;
-					if (getStateJson (jsonOnOffBaseIdx + note) > 0.f && semiAmt > 0.f) {
-						d = fabs (cvIn - cvOut);
-						pCvOut[pCnt] = cvOut;
-						if (getStateJson(ROOT_BASED_DISPLAY_JSON) == 1.f)
-							weight = getStateParam (WEIGHT_PARAM + (noteIdx + effectiveChild) % NUM_NOTES);
-						else
-							if (getStateJson(C_BASED_DISPLAY_JSON) == 1.f)
-								weight = getStateParam (WEIGHT_PARAM + (noteIdx + effectiveChild + effectiveRoot) % NUM_NOTES);
-							else
-								weight = getStateParam (WEIGHT_PARAM + noteIdx);
-						if (weight == 0.5f && effectiveChild > 0 && getStateJson (DNA_DISABLED_JSON) == 0.f) {
-							fromMother = true;
-							weight = motherWeights[noteIdx];
-						}
-						else
-							fromMother = false;
-						if (weight == 1.f && getStateJson (GRAB_DISABLED_JSON) == 0.f) {
-							pProb[0] = 1.f;
-							pNoteIdx[0] = noteIdx;
-							pMother[0] = fromMother;
-							pTotal = 1.f;
-							pCnt = 1;
-							grab = true;
-						}
-						else {
-							pProb[pCnt] = weight;
-							pNoteIdx[pCnt] = noteIdx;
-							pMother[pCnt] = fromMother;
-							pTotal += weight;
-							pCnt ++;
-						}
-					}
-					if ((getStateJson (jsonOnOffBaseIdx + note) == 0.f || semiAmt > 0.f) && !grab) {
-						float step = -SEMITONE;
-						if (cvIn > cvOut)
-							step = SEMITONE;
-						for (int i = 0; i < NUM_NOTES; i++) {
-							cvOut += step;
-							note = note (cvOut);
-							noteIdx = (note - effectiveChild + NUM_NOTES) % NUM_NOTES;
-							if (getStateJson (jsonOnOffBaseIdx + note) > 0.f) {
-								if (semiAmt == 0.f)
-									break;
-								d = fabs (cvIn - cvOut);
-								if (d > semiAmt + PRECISION)
-									break;
-								pCvOut[pCnt] = cvOut;
-								if (getStateJson(ROOT_BASED_DISPLAY_JSON) == 1.f)
-									weight = getStateParam (WEIGHT_PARAM + (noteIdx + effectiveChild) % NUM_NOTES);
-								else
-									if (getStateJson(C_BASED_DISPLAY_JSON) == 1.f)
-										weight = getStateParam (WEIGHT_PARAM + (noteIdx + effectiveChild + effectiveRoot) % NUM_NOTES);
-									else
-										weight = getStateParam (WEIGHT_PARAM + noteIdx);
-								if (weight == 0.5f && effectiveChild > 0 && getStateJson (DNA_DISABLED_JSON) == 0.f) {
-									fromMother = true;
-									weight = motherWeights[noteIdx];
-								}
-								else
-									fromMother = false;
-								if (weight == 1.f && getStateJson (GRAB_DISABLED_JSON) == 0.f) {
-									pProb[0] = 1.f;
-									pNoteIdx[0] = noteIdx;
-									pMother[0] = fromMother;
-									pTotal =  1.f;
-									pCnt = 1;
-									grab = true;
-									break;
-								}
-								if (weight > 0) {
-									//
-									// New polynomial style:
-									// 
-									//	Ronald supposed:
-									// 		f(x) = 1 - (x/s)**n
-									//
-									//	Python test:
-									//		def weight(dist, span, shape):
-									//    		if shape < 0.5:
-									//        		shape *= 2
-									//    		else:
-									//        		shape = (shape - 0.5) * 20
-									//    	return 1.0 - (float(dist)/float(span))**shape
-									//
-									if (shp < 1.f) {
-										float f = (1.f - pow (d / semiAmt, shp < 0.5f ? shp * 2.f : 1.f + (shp - 0.5f) * 20.f));
-										weight *= f;
-									}
-									//
-									// Old linear style (faster but not as fancy) elts keep it for now if performance is needed:
-									//	weight *= ((shp == 1.f) ? 1.f : 1.f - (d * (1 - shp)) / semiAmt);
-									//
-
-									pProb[pCnt] = weight;
-									pNoteIdx[pCnt] = noteIdx;
-									pMother[pCnt] = fromMother;
-									pTotal += weight;
-									pCnt ++;
-								}
-							}
-							step = step > 0.f ? -step - SEMITONE : -step + SEMITONE;
-						}
-					}
-					if (pCnt > 0 && !grab) {
-						float sum = 0.f;
-						rnd = genrand_real () * pTotal;
-						for (int i = 0; i < pCnt; i++) {
-							sum += pProb[i];
-							if (sum >= rnd) {
-								cvOut = pCvOut[i];
-								noteIdx = pNoteIdx[i];
-								break;
-							}
-						}
+					else {
+						/*
+							CV_CHANGE_THRESHOLD only filters the change detection of cv mode,
+							a trigger samples the current voltage, not the last accepted one
+						*/
+						float cv = trgConnected ? inputs[CV_INPUT].getVoltage (channel) : OL_statePoly[cvInPolyIdx];
+						if (!std::isfinite (cv))
+							cv = 0.f;
+						cvIn = cv - (float(channelRoot[channel]) / 12.f);
 					}
-					if (pCnt == 0) {
-						pCvOut[0] = cvOut;
-						pProb[0] = weight;
-						pNoteIdx[0] = noteIdx;
-						pMother[0] = fromMother;
-						pTotal = weight;
-						pCnt = 1;
+					traceEvent (TRC_TRIGGER, channel, cvIn);
+					FateNotes &notes = getFateNotes (channelScale[channel], channelChild[channel]);
+					candidates = &fateCandidates (notes, cvIn, semiAmt, shp);
+					traceEvent (TRC_CANDIDATES, channel, candidates->pCnt);
+					pick = -1;
+					if (candidates->pCnt > 0 && !candidates->grab) {
+						rnd = genrand_real () * candidates->pCnt;
+						pick = int(rnd);
+						if (pick >= candidates->pCnt)	// float rounding of values just below pCnt
+							pick = candidates->pCnt - 1;
+						if (rnd - pick >= candidates->aliasProb[pick])
+							pick = candidates->alias[pick];
 					}
+					cvOut = pick >= 0 ? candidates->pCvOut[pick] : candidates->cvOut;
+					lastNoteIdx = pick >= 0 ? candidates->pNoteIdx[pick] : candidates->noteIdx;
 
-					cvOut += (float(effectiveRoot) / 12.f);
+					cvOut += (float(channelRoot[channel]) / 12.f);
 					cvOut = quantize (cvOut);
+					traceEvent (TRC_NOTE, channel, cvOut);
+					traceEvent (TRC_PROBABILITY, channel, pick >= 0 ? candidates->pProb[pick] / candidates->pTotal : 1.f);
 
 					if (fabs (cvOut - oldCvOut[channel]) > PRECISION) {
 						if (OL_statePoly[NUM_INPUTS * POLY_CHANNELS + trgOutPolyIdx] != 10.f) {
 							OL_statePoly[NUM_INPUTS * POLY_CHANNELS + trgOutPolyIdx] = 10.f;
 							OL_outStateChangePoly[trgOutPolyIdx] = true;
 						}
-						note = note (cvOut);
-						noteIdx = (note - effectiveChild + NUM_NOTES) % NUM_NOTES;
-						if (getStateJson(ROOT_BASED_DISPLAY_JSON) == 1.f)
-							weight = getStateParam (WEIGHT_PARAM + (noteIdx + effectiveChild) % NUM_NOTES);
-						else
-							if (getStateJson(C_BASED_DISPLAY_JSON) == 1.f)
-								weight = getStateParam (WEIGHT_PARAM + (noteIdx + effectiveChild + effectiveRoot) % NUM_NOTES);
-							else
-								weight = getStateParam (WEIGHT_PARAM + noteIdx);
-						if (weight == 0.5f && effectiveChild > 0 && getStateJson (DNA_DISABLED_JSON) == 0.f)
-							weight = motherWeights[noteIdx];
-						OL_statePoly[NUM_INPUTS * POLY_CHANNELS + powOutPolyIdx] = weight * 10.f;
+						int note = note (cvOut);
+						lastNoteIdx = notes.noteIdx[note];
+						OL_statePoly[NUM_INPUTS * POLY_CHANNELS + powOutPolyIdx] = notes.weight[note] * 10.f;
 						OL_outStateChangePoly[powOutPolyIdx] = true;
 					}
 					if (OL_statePoly[NUM_INPUTS * POLY_CHANNELS + cvOutPolyIdx] != cvOut) {
@@ -525,10 +570,35 @@ struct Mother : Module {
 						OL_outStateChangePoly[cvOutPolyIdx] = true;
 					}
 					oldCvOut[channel] = cvOut;
+					lastChannel = channel;
 				}
 				else
 					lastWasTrigger = false;
 			}
+			if (lastChannel < 0)
+				return;
+			visualColorsPending = true;
+
+			/*
+				The visualization shows the last triggered channel, copy its candidates once per sample
+			*/
+			reflectCounter = REFLECT_DURATION;
+			noteIdxIn = (note (cvIn) - channelChild[lastChannel] + NUM_NOTES) % NUM_NOTES;
+			noteIdx = lastNoteIdx;
+			pCnt    = candidates->pCnt;
+			pTotal  = candidates->pTotal;
+			memcpy (pCvOut,   candidates->pCvOut,   sizeof (pCvOut));
+			memcpy (pProb,    candidates->pProb,    sizeof (pProb));
+			memcpy (pNoteIdx, candidates->pNoteIdx, sizeof (pNoteIdx));
+			memcpy (pMother,  candidates->pMother,  sizeof (pMother));
+			if (pCnt == 0) {
+				pCvOut[0] = candidates->cvOut;
+				pProb[0] = candidates->weight;
+				pNoteIdx[0] = candidates->noteIdx;
+				pMother[0] = candidates->fromMother;
+				pTotal = candidates->weight;
+				pCnt = 1;
+			}
 		}
 	}
 
@@ -542,43 +612,53 @@ struct Mother : Module {
 		This method should not do dsp or other logic processing.
 	*/
 	inline void moduleProcessState () {
-		effectiveScale = (int(getStateParam (SCL_PARAM)) - 1 + note (getStateInput (SCL_INPUT))) % NUM_NOTES;
-		effectiveScaleDisplay = float(effectiveScale + 1);
-		effectiveChild = (int(getStateParam (CHLD_PARAM)) + note (getStateInput (CHLD_INPUT))) % NUM_NOTES;
-		/*
-			quantize down to next lower active note if effectiveChild is not in scale
-		*/
-		while (effectiveChild > 0) {
-			if (getStateJson (ONOFF_JSON + effectiveScale * NUM_NOTES + effectiveChild) > 0.f)
-				break;
-			effectiveChild --;			
+		int keyChannels = inputs[SCL_INPUT].getChannels () + (inputs[CHLD_INPUT].getChannels () << 5) + (inputs[ROOT_INPUT].getChannels () << 10);
+		if ((customChangeBits & (CHG_SCL | CHG_CHLD | CHG_ROOT)) || !initialized || keysPending || keyChannels != keyInputChannels) {
+			keyInputChannels = keyChannels;
+			keysPending = false;
+			for (int channel = 0; channel < POLY_CHANNELS; channel++) {
+				int scale = (int(getStateParam (SCL_PARAM)) - 1 + keyInputNote (SCL_INPUT, channel)) % NUM_NOTES;
+				int child = (int(getStateParam (CHLD_PARAM)) + keyInputNote (CHLD_INPUT, channel)) % NUM_NOTES;
+				/*
+					quantize down to next lower active note if child is not in scale
+				*/
+				while (child > 0) {
+					if (getStateJson (ONOFF_JSON + scale * NUM_NOTES + child) > 0.f)
+						break;
+					child --;
+				}
+				channelScale[channel] = scale;
+				channelChild[channel] = child;
+				channelRoot [channel] = (int(getStateParam (ROOT_PARAM)) + keyInputNote (ROOT_INPUT, channel)) % NUM_NOTES;
+			}
+			/*
+				From here on CHG_SCL, CHG_CHLD and CHG_ROOT only flag changes of the panel's channel 0,
+				modulating the other channels must not rewrite knobs, head text or lights
+			*/
+			if (initialized) {
+				customChangeBits &= ~(CHG_SCL | CHG_CHLD | CHG_ROOT);
+				if (channelScale[0] != effectiveScale)
+					customChangeBits |= CHG_SCL;
+				if (channelChild[0] != effectiveChild)
+					customChangeBits |= CHG_CHLD;
+				if (channelRoot[0] != effectiveRoot)
+					customChangeBits |= CHG_ROOT;
+			}
 		}
-
-		effectiveRoot  = (int(getStateParam (ROOT_PARAM)) + note (getStateInput (ROOT_INPUT))) % NUM_NOTES;
+		effectiveScale = channelScale[0];
+		effectiveScaleDisplay = float(effectiveScale + 1);
+		effectiveChild = channelChild[0];
+		effectiveRoot  = channelRoot[0];
 
 		jsonOnOffBaseIdx = ONOFF_JSON + effectiveScale * NUM_NOTES;
 		int jsonIdx;
 		float f;
 
 		bool didSelectScale = false;
-		float selectedNotes[NUM_NOTES];
-		selectedNotes[0] = 1.f;
+		int selectedMask = 0;
 		if (scaleSelected >= 0) {
 			// Scale selected from right click menu
-			int noteIdx = 1;
-			int interval;
-			for (const char *p = scaleKeys[scaleSelected]; *p != '\0'; p++) {
-				interval = *p - '0' - 1;
-				while (interval--)
-					if (noteIdx < NUM_NOTES) {
-						selectedNotes[noteIdx] = 0.f;
-						noteIdx++;
-					}
-				if (noteIdx < NUM_NOTES) {
-					selectedNotes[noteIdx] = 1.f;
-					noteIdx++;
-				}
-			}
+			selectedMask = scaleTables ().mask[scaleSelected];
 			didSelectScale = true;
 			scaleSelected = -1;
 			customChangeBits |= CHG_ONOFF;
@@ -590,7 +670,7 @@ struct Mother : Module {
 					if ((inChangeParam (paramIdx) && paramIdx - ONOFF_PARAM != 0) || didSelectScale) {
 						jsonIdx = jsonOnOffBaseIdx + i;
 						if (didSelectScale)
-							f = selectedNotes[i];
+							f = (selectedMask & (1 << i)) ? 1.f : 0.f;
 						else {
 							f = getStateJson (jsonIdx);
 							if (f == 0.f)
@@ -603,8 +683,16 @@ struct Mother : Module {
 				}
 			}
 			didSelectScale = false;
+			keysPending = true;		// children of the other channels might have to be quantized down
 		}
 		jsonWeightBaseIdx = WEIGHT_JSON + effectiveScale * NUM_CHLD * NUM_NOTES + effectiveChild * NUM_NOTES;
+		if (!initialized) {
+			for (int scale = 0; scale < NUM_SCALES; scale++)
+				scaleVersion[scale] ++;
+		}
+		else
+			if ((customChangeBits & CHG_ONOFF) || ((customChangeBits & CHG_WEIGHT) && effectiveChild == 0))
+				scaleVersion[effectiveScale] ++;
 		if (customChangeBits & CHG_WEIGHT && initialized) {
 			float weight;
 			int pct;
@@ -644,196 +732,385 @@ struct Mother : Module {
 						jsonIdx = jsonWeightBaseIdx + i;
 				setStateParam (paramIdx, getStateJson (jsonIdx));
 			}
-			updateMotherWeights ();
 		}
 		if ((inChangeParam (FATE_AMT_PARAM) || inChangeParam (FATE_SHP_PARAM))  && initialized) {
 			reflectFateCounter = REFLECT_FATE_DURATION;
 		}
+		if (getStateParam (FATE_SHP_PARAM) != fateShapeShp)
+			updateFateShape ();
+		if ((customChangeBits & (CHG_WEIGHT | CHG_ONOFF)) || !initialized || disableGrabChanged || disableDnaChanged)
+			fateVersion ++;
+		fateNotes = &getFateNotes (effectiveScale, effectiveChild);
+		if (fateNotes->epoch != restColorsEpoch)
+			updateRestColors ();
 	}
 
-	void updateMotherWeights () {
-		int onOffJsonBaseIdx = ONOFF_JSON + effectiveScale * NUM_NOTES;
-		int steps;
-		int motherIdx;
-		int childIdx;
-		for (int i = 0; i < NUM_NOTES; i++) {
-			childIdx = i;
+	/**
+		Note of a poly key input (SCL, CHLD, ROOT) for a channel, channels missing on the input follow channel 0
+	*/
+	inline int keyInputNote (int inputIdx, int channel) {
+		if (!getInputConnected (inputIdx))
+			return 0;
+		if (channel >= inputs[inputIdx].getChannels ())
+			channel = 0;
+		return note (OL_statePoly[inputIdx * POLY_CHANNELS + channel]);
+	}
 
-			steps = 0;
-			while (childIdx > 0) {
-				if (getStateJson (onOffJsonBaseIdx + (childIdx + effectiveChild) % NUM_NOTES) > 0.f) {
-					steps++;
-				}
-				childIdx--;
+	/**
+		Candidate notes of the fate search for a cv in, cached by the exact cv in.
+		The candidates only depend on cv in, fate amount and shape and the fate notes,
+		so repeated triggers of the same cv (chords, sequences) cost one lookup.
+		Fate notes get a new epoch whenever they are recalculated, which invalidates their cache entries
+	*/
+	FateCandidates &fateCandidates (FateNotes &n, float cvIn, float semiAmt, float shp) {
+		uint32_t bits;
+		memcpy (&bits, &cvIn, sizeof (bits));
+		FateCandidates &c = fateCache[(bits ^ (bits >> 11) ^ (bits >> 19) ^ n.epoch) & (FATE_CACHE_SIZE - 1)];
+		if (c.epoch == n.epoch && c.bits == bits && c.semiAmt == semiAmt && c.shp == shp)
+			return c;
+
+		c.epoch      = n.epoch;
+		c.bits       = bits;
+		c.semiAmt    = semiAmt;
+		c.shp        = shp;
+		c.pCnt       = 0;
+		c.pTotal     = 0.f;
+		c.grab       = false;
+		c.weight     = 0.f;
+		c.fromMother = false;
+		float d;
+
+		c.cvOut = quantize (cvIn);
+		int note = note(c.cvOut);
+		c.noteIdx = n.noteIdx[note];
+		if (n.on[note] && semiAmt > 0.f) {
+			d = fabs (cvIn - c.cvOut);
+			c.pCvOut[c.pCnt] = c.cvOut;
+			c.weight = n.weight[note];
+			c.fromMother = n.mother[note];
+			if (n.grab[note]) {
+				c.pProb[0] = 1.f;
+				c.pNoteIdx[0] = c.noteIdx;
+				c.pMother[0] = c.fromMother;
+				c.pTotal = 1.f;
+				c.pCnt = 1;
+				c.grab = true;
 			}
-			for (motherIdx = 0; motherIdx < NUM_NOTES; motherIdx ++) {
-				if (getStateJson (onOffJsonBaseIdx + motherIdx) > 0.f) {
-					steps --;
-					if (steps < 0)
+			else {
+				c.pProb[c.pCnt] = c.weight;
+				c.pNoteIdx[c.pCnt] = c.noteIdx;
+				c.pMother[c.pCnt] = c.fromMother;
+				c.pTotal += c.weight;
+				c.pCnt ++;
+			}
+		}
+		if ((!n.on[note] || semiAmt > 0.f) && !c.grab) {
+			float step = -SEMITONE;
+			if (cvIn > c.cvOut)
+				step = SEMITONE;
+			for (int i = 0; i < NUM_NOTES; i++) {
+				c.cvOut += step;
+				note = note (c.cvOut);
+				c.noteIdx = n.noteIdx[note];
+				if (n.on[note]) {
+					if (semiAmt == 0.f)
+						break;
+					d = fabs (cvIn - c.cvOut);
+					if (d > semiAmt + PRECISION)
 						break;
+					c.pCvOut[c.pCnt] = c.cvOut;
+					c.weight = n.weight[note];
+					c.fromMother = n.mother[note];
+					if (n.grab[note]) {
+						c.pProb[0] = 1.f;
+						c.pNoteIdx[0] = c.noteIdx;
+						c.pMother[0] = c.fromMother;
+						c.pTotal =  1.f;
+						c.pCnt = 1;
+						c.grab = true;
+						break;
+					}
+					if (c.weight > 0) {
+						//
+						// New polynomial style:
+						// 
+						//	Ronald supposed:
+						// 		f(x) = 1 - (x/s)**n
+						//
+						//	Python test:
+						//		def weight(dist, span, shape):
+						//    		if shape < 0.5:
+						//        		shape *= 2
+						//    		else:
+						//        		shape = (shape - 0.5) * 20
+						//    	return 1.0 - (float(dist)/float(span))**shape
+						//
+						if (shp < 1.f) {
+							c.weight *= fateShapeWeight (d / semiAmt);
+						}
+						//
+						// Old linear style (faster but not as fancy) elts keep it for now if performance is needed:
+						//	weight *= ((shp == 1.f) ? 1.f : 1.f - (d * (1 - shp)) / semiAmt);
+						//
+
+						c.pProb[c.pCnt] = c.weight;
+						c.pNoteIdx[c.pCnt] = c.noteIdx;
+						c.pMother[c.pCnt] = c.fromMother;
+						c.pTotal += c.weight;
+						c.pCnt ++;
+					}
 				}
+				step = step > 0.f ? -step - SEMITONE : -step + SEMITONE;
 			}
-			motherWeights[i] = getStateJson (WEIGHT_JSON + effectiveScale * NUM_CHLD * NUM_NOTES + motherIdx);
 		}
+		buildAliasTable (c);
+		return c;
+	}
+
+	/**
+		Tabulate the fate shape curve 1 - x**n for the current shape,
+		keeps pow () out of the fate search and the fate display
+	*/
+	void updateFateShape () {
+		fateShapeShp = getStateParam (FATE_SHP_PARAM);
+		float n = fateShapeShp < 0.5f ? fateShapeShp * 2.f : 1.f + (fateShapeShp - 0.5f) * 20.f;
+		for (int i = 0; i <= FATE_SHAPE_SIZE; i++)
+			fateShape[i] = 1.f - pow (float(i) / FATE_SHAPE_SIZE, n);
+		fateShape[FATE_SHAPE_SIZE + 1] = fateShape[FATE_SHAPE_SIZE];
+	}
+
+	/**
+		Fate shape curve at normalized distance x (distance / fate amount)
+	*/
+	inline float fateShapeWeight (float x) {
+		if (x >= 1.f)
+			return fateShape[FATE_SHAPE_SIZE];
+		float pos = x * FATE_SHAPE_SIZE;
+		int i = int(pos);
+		return fateShape[i] + (fateShape[i + 1] - fateShape[i]) * (pos - i);
+	}
+
+	/**
+		Vose's alias method: split the candidate distribution into pCnt columns of height 1,
+		each holding its own candidate with probability aliasProb and the alias candidate otherwise,
+		so a draw takes one random number and one compare
+	*/
+	void buildAliasTable (FateCandidates &c) {
+		int small[NUM_NOTES];
+		int large[NUM_NOTES];
+		float scaled[NUM_NOTES];
+		int smallCnt = 0;
+		int largeCnt = 0;
+
+		for (int i = 0; i < c.pCnt; i++) {
+			scaled[i] = c.pTotal > 0.f ? c.pProb[i] * c.pCnt / c.pTotal : 1.f;
+			c.alias[i] = i;
+			if (scaled[i] < 1.f)
+				small[smallCnt++] = i;
+			else
+				large[largeCnt++] = i;
+		}
+		while (smallCnt > 0 && largeCnt > 0) {
+			int s = small[--smallCnt];
+			int l = large[--largeCnt];
+			c.aliasProb[s] = scaled[s];
+			c.alias[s] = l;
+			scaled[l] -= 1.f - scaled[s];
+			if (scaled[l] < 1.f)
+				small[smallCnt++] = l;
+			else
+				large[largeCnt++] = l;
+		}
+		// Leftovers are 1 up to rounding errors
+		while (largeCnt > 0)
+			c.aliasProb[large[--largeCnt]] = 1.f;
+		while (smallCnt > 0)
+			c.aliasProb[small[--smallCnt]] = 1.f;
+	}
+
+	/**
+		Derive the effective weight of every note of a scale and child,
+		so the fate search does not have to look at json state, DNA and GRAB rules per candidate
+	*/
+	void updateFateNotes (int scale, int child, ScaleChildState &s) {
+		FateNotes &n = s.notes;
+		bool dna  = child > 0 && getStateJson (DNA_DISABLED_JSON) == 0.f;
+		bool grab = getStateJson (GRAB_DISABLED_JSON) == 0.f;
+		int weightJsonBaseIdx = WEIGHT_JSON + scale * NUM_CHLD * NUM_NOTES + child * NUM_NOTES;
+		float weight;
+		int noteIdx;
+		for (int note = 0; note < NUM_NOTES; note++) {
+			noteIdx = (note - child + NUM_NOTES) % NUM_NOTES;
+			weight = getStateJson (weightJsonBaseIdx + noteIdx);
+			n.mother[note] = (weight == 0.5f && dna);
+			if (n.mother[note])
+				weight = s.motherWeights[noteIdx];
+			n.on[note]      = getStateJson (ONOFF_JSON + scale * NUM_NOTES + note) > 0.f;
+			n.weight[note]  = weight;
+			n.grab[note]    = (weight == 1.f && grab);
+			n.noteIdx[note] = noteIdx;
+		}
+		n.epoch = fateEpoch ++;
+	}
+
+	/**
+		Light colors outside of the visualization from the fate notes of the panel's scale and child
+	*/
+	void updateRestColors () {
+		restColorsEpoch = fateNotes->epoch;
+		for (int note = 0; note < NUM_NOTES; note++) {
+			int noteIdx = fateNotes->noteIdx[note];
+			float weight = fateNotes->weight[note];
+			if (!fateNotes->on[note])
+				restColors[noteIdx] = 0x000000;
+			else if (fateNotes->grab[note])
+				restColors[noteIdx] = fateNotes->mother[note] ? 0xc40040 : 0xff0000;
+			else if (fateNotes->mother[note])
+				restColors[noteIdx] = int(weight * 223.f + 32.f);
+			else
+				restColors[noteIdx] = int(weight * 223.f + 32.f) << 8;
+		}
+		visualColorsPending = true;
 	}
 
-	inline void setNoteLight (int lightIdx, float state) {
+	/**
+		Notes on in a scale as bit mask, bit n is note n
+	*/
+	int onOffMask (int scale) {
+		int mask = 0;
+		for (int note = 0; note < NUM_NOTES; note++)
+			if (getStateJson (ONOFF_JSON + scale * NUM_NOTES + note) > 0.f)
+				mask |= 1 << note;
+		return mask;
+	}
+
+	/**
+		Map the degrees of the child to the degrees of the mother scale:
+		the degree of child note i is the number of notes on in the child above its root up to note i,
+		the mother note is the note on with the same degree in the mother scale
+	*/
+	void updateMotherWeights (int scale, int child, float *motherWeights) {
+		int mask = onOffMask (scale);
+		int childMask = ((mask >> child) | (mask << (NUM_NOTES - child))) & (NUM_MASKS - 1);
+		int motherIdx;
+		for (int i = 0; i < NUM_NOTES; i++) {
+			motherIdx = degreeTables.select[mask][degreeTables.count[childMask & ((2 << i) - 2)]];
+			motherWeights[i] = getStateJson (WEIGHT_JSON + scale * NUM_CHLD * NUM_NOTES + motherIdx);
+		}
+	}
 
-		int color = 0x000000;
+	/**
+		Light colors of the fate amount and shape display, lights sorted by distance from the center
+	*/
+	void updateFateColors () {
+		fateColorsAmt = getStateParam (FATE_AMT_PARAM);
+		fateColorsShp = fateShapeShp;
+		float semiAmt = fateColorsAmt / 12.f;
 		float weight;
-		float motherWeight;
-		float reflectWeight = 0;
-		int r = 0, g = 0, b = 0;
-
-		if (reflectFateCounter > 0) {
-			float semiAmt = getStateParam (FATE_AMT_PARAM) / 12.f;
-			float shp = getStateParam (FATE_SHP_PARAM);
-			float d;
+		float d;
+		for (int lightIdx = 0; lightIdx < NUM_NOTES; lightIdx++) {
 			if (lightIdx < NUM_NOTES / 2)
 				d = fabs ((5.5f - lightIdx) / 12.f);
 			else
 				d = fabs ((lightIdx - 5.5f) / 12.f);
 			if (d > semiAmt + PRECISION)
 				weight = 0.f;
-			else {
-				weight = (1.f - pow (d / semiAmt, shp < 0.5f ? shp * 2.f : 1.f + (shp - 0.5f) * 20.f));
-			}
-			r = 0;
-			g = int(weight * 255.f);
-			b = 0;
-			color = (r << 16) + (g << 8) + b;
-		}
-		else {
-			if (getStateJson(ROOT_BASED_DISPLAY_JSON) == 1.f)
-				weight = getStateParam (WEIGHT_PARAM + (lightIdx + effectiveChild) % NUM_NOTES);
 			else
-				if (getStateJson(C_BASED_DISPLAY_JSON) == 1.f)
-					weight = getStateParam (WEIGHT_PARAM + (lightIdx + effectiveChild + effectiveRoot) % NUM_NOTES);
-				else
-					weight = getStateParam (WEIGHT_PARAM + lightIdx);
-
-			if (channels == 1) {
+				weight = fateShapeWeight (d / semiAmt);
+			fateColors[lightIdx] = int(weight * 255.f) << 8;
+		}
+	}
 
-				if (state > 0.f || (reflectCounter > 0 && getStateJson(VISUALIZATION_DISABLED_JSON) == 0.f && noteIdxIn == lightIdx)) {
-					int r = 0, g = 0, b = 0;
-					if (reflectCounter > 0 && getStateJson(VISUALIZATION_DISABLED_JSON) == 0.f) {
-						if (noteIdxIn == lightIdx) {
-								g = 32;
-								b = 32;
-								r = 32;
-						}
-						else {
-							int i;
-							for (i = 0; i < pCnt; i++) {
-								if (pNoteIdx[i] == lightIdx) {
-									reflectWeight = pProb[i];
-									break;
-								}
-							}
-							if (reflectWeight == 1.f && getStateJson (GRAB_DISABLED_JSON) == 0.f) {
-								if (weight == 1.f)
-									r = 255;
-								else if (pMother[i]) {
-									b = 64;
-									r = 196;
-								}
-							}
-							else {
-								if (pMother[i])
-									b = int(reflectWeight * 255.f);
-								else
-									g = int(reflectWeight * 255.f);
-							}
-						}
-						if (noteIdx == lightIdx) {
-							r = 255;
-							g = 255;
-							b = 255;
-						}
-					}
-					else {
-						if (weight == 0.5f && effectiveChild > 0 && getStateJson (DNA_DISABLED_JSON) == 0.f) {
-							r = 0;
-							g = 0;
-							motherWeight = motherWeights[lightIdx];
-							if (motherWeight == 1.f && getStateJson (GRAB_DISABLED_JSON) == 0.f) {
-								r = 196;
-								b = 64;
-							}
-							else
-								b = int(motherWeight * 223.f + 32.f);
-						}
-						else if (weight == 1.f && getStateJson (GRAB_DISABLED_JSON) == 0.f) {
-							r = 255;
-							g = 0;
-							b = 0;
-						}
-						else {
-							r = 0;
-							g = int(weight * 223.f + 32.f);
-							b = 0;
-						}
-					}
-					color = (r << 16) + (g << 8) + b;
+	/**
+		Light colors showing the last fate search (mono) or the notes played by all channels (poly),
+		recalculated once per trigger instead of per light and reflect
+	*/
+	void updateVisualColors () {
+		visualColorsPending = false;
+		if (channels == 1) {
+			bool grab = getStateJson (GRAB_DISABLED_JSON) == 0.f;
+			for (int lightIdx = 0; lightIdx < NUM_NOTES; lightIdx++) {
+				int note = (lightIdx + effectiveChild) % NUM_NOTES;
+				int r = 0, g = 0, b = 0;
+				if (!fateNotes->on[note] && noteIdxIn != lightIdx) {
+					visualColors[lightIdx] = 0x000000;
+					continue;
 				}
-				else {
-					color = 0x000000;
+				if (noteIdxIn == lightIdx) {
+					r = 32;
+					g = 32;
+					b = 32;
 				}
-			}
-			else {
-				if (state > 0.f) {
-					bool hit = false;
-					if (reflectCounter > 0 && getStateJson(VISUALIZATION_DISABLED_JSON) == 0.f) {
-						for (int channel = 0; channel < channels; channel++) {
-							int note = note (oldCvOut[channel]);
-							noteIdx = (note - effectiveChild + NUM_NOTES) % NUM_NOTES;
-							if (noteIdx == lightIdx) {
-								r = 255;
-								g = 255;
-								b = 255;
-								hit = true;
-								break;
-							}
+				else {
+					float reflectWeight = 0.f;
+					bool fromMother = false;
+					for (int i = 0; i < pCnt; i++) {
+						if (pNoteIdx[i] == lightIdx) {
+							reflectWeight = pProb[i];
+							fromMother = pMother[i];
+							break;
 						}
 					}
-					if (!hit) {
-						if (weight == 0.5f && effectiveChild > 0 && getStateJson (DNA_DISABLED_JSON) == 0.f) {
-							r = 0;
-							g = 0;
-							motherWeight = motherWeights[lightIdx];
-							if (motherWeight == 1.f && getStateJson (GRAB_DISABLED_JSON) == 0.f) {
-								r = 196;
-								b = 64;
-							}
-							else
-								b = int(motherWeight * 223.f + 32.f);
-						}
-						else if (weight == 1.f && getStateJson (GRAB_DISABLED_JSON) == 0.f) {
+					if (reflectWeight == 1.f && grab) {
+						if (fateNotes->weight[note] == 1.f && !fateNotes->mother[note])
 							r = 255;
-							g = 0;
-							b = 0;
-						}
-						else {
-							r = 0;
-							g = int(weight * 223.f + 32.f);
-							b = 0;
+						else if (fromMother) {
+							b = 64;
+							r = 196;
 						}
 					}
-					color = (r << 16) + (g << 8) + b;
+					else {
+						if (fromMother)
+							b = int(reflectWeight * 255.f);
+						else
+							g = int(reflectWeight * 255.f);
+					}
 				}
-				else {
-					color = 0x000000;
+				if (noteIdx == lightIdx) {
+					r = 255;
+					g = 255;
+					b = 255;
 				}
+				visualColors[lightIdx] = (r << 16) + (g << 8) + b;
+			}
+		}
+		else {
+			int hits = 0;
+			for (int channel = 0; channel < channels; channel++)
+				hits |= 1 << ((note (oldCvOut[channel]) - effectiveChild + NUM_NOTES) % NUM_NOTES);
+			for (int lightIdx = 0; lightIdx < NUM_NOTES; lightIdx++) {
+				if (restColors[lightIdx] != 0x000000 && (hits & (1 << lightIdx)))
+					visualColors[lightIdx] = 0xffffff;
+				else
+					visualColors[lightIdx] = restColors[lightIdx];
 			}
 		}
+	}
+
+	/**
+		Set the note lights from the precalculated colors of the current display
+	*/
+	inline void setNoteLights (bool fate, bool visual) {
+		const int *colors = restColors;
+		if (fate) {
+			if (getStateParam (FATE_AMT_PARAM) != fateColorsAmt || fateShapeShp != fateColorsShp)
+				updateFateColors ();
+			colors = fateColors;
+		}
+		else if (visual) {
+			if (visualColorsPending)
+				updateVisualColors ();
+			colors = visualColors;
+		}
+		int offset = 0;
 		if (getStateJson(ROOT_BASED_DISPLAY_JSON) == 1.f)
-			lightIdx = (lightIdx + effectiveChild) % NUM_NOTES;
+			offset = effectiveChild;
 		else
 			if (getStateJson(C_BASED_DISPLAY_JSON) == 1.f)
-				lightIdx = (lightIdx + effectiveChild + effectiveRoot) % NUM_NOTES;
-
-		setRgbLight (NOTE_LIGHT_01_RGB + 3 * lightIdx, color);
-	}	
+				offset = effectiveChild + effectiveRoot;
+		for (int lightIdx = 0; lightIdx < NUM_NOTES; lightIdx++)
+			setRgbLight (NOTE_LIGHT_01_RGB + 3 * ((lightIdx + offset) % NUM_NOTES), colors[lightIdx]);
+	}
 
 	/*
 		Non standard reflect processing results to user interface components and outputs
@@ -854,36 +1131,58 @@ struct Mother : Module {
 		if ((customChangeBits & CHG_ROOT) || !initialized) {
 			strcpy ( rootText, notes[effectiveRoot]);
 		}
+		/*
+			Lights are calculated at UI rate, so we have to catch the end of the visualization explicitly
+		*/
+		bool visualizing = (reflectCounter >= 0 && getStateJson(VISUALIZATION_DISABLED_JSON) == 0.f) || reflectFateCounter >= 0;
 		if (triggered || (customChangeBits & (CHG_WEIGHT | CHG_ONOFF | CHG_SCL | CHG_CHLD | CHG_ROOT)) || !initialized ||
-		    (reflectCounter >= 0 && getStateJson(VISUALIZATION_DISABLED_JSON) == 0.f) || reflectFateCounter >= 0 || visualizationDisabledChanged || rootBasedDisplayChanged || disableGrabChanged || disableDnaChanged) {
+		    visualizing || wasVisualizing || visualizationDisabledChanged || rootBasedDisplayChanged || disableGrabChanged || disableDnaChanged) {
 			rootBasedDisplayChanged = false;
+			cBasedDisplayChanged = false;
 			visualizationDisabledChanged = false;
 			disableGrabChanged = false;
 			disableDnaChanged = false;
-			int jsonIdx = ONOFF_JSON + effectiveScale * NUM_NOTES;
-			int lightIdx;
-			for (int idx = 0; idx < NUM_NOTES; idx ++, jsonIdx ++) {
-				lightIdx = (idx - effectiveChild + NUM_NOTES) % NUM_NOTES;
-				setNoteLight (lightIdx, getStateJson (jsonIdx));
-			}
+			noteLightsPending = true;
+		}
+		wasVisualizing = visualizing;
+		/*
+			Note lights are only calculated when the framework reflects lights
+		*/
+		if (noteLightsPending && uiReflect) {
+			noteLightsPending = false;
+			setNoteLights (reflectFateCounter > 0, reflectCounter > 0 && getStateJson(VISUALIZATION_DISABLED_JSON) == 0.f);
 		}
-		if (headScrollTimer > 0)
-			headScrollTimer --;
 	}
 };
 
+/*
+	Definitions of the tables shared by all Mother instances
+*/
+constexpr const char *Mother::notes[NUM_NOTES];
+constexpr const char *Mother::namedJsonLabel[ONOFF_JSON];
+constexpr const char *Mother::scaleKeys[SCALE_KEYS];
+constexpr const char *Mother::scaleNames[SCALE_KEYS];
+
 // ********************************************************************************************************************************
 /*
 	Module widget implementation
 */
-struct KeysWidget : TransparentWidget {
+/**
+	Keyboard strip showing which light is on which key
+	Cached in a framebuffer, only redrawn when the key offset changes
+*/
+struct KeysWidget : FramebufferWidget {
 
 	Mother     *module = nullptr;
 
+	CachedContent<KeysWidget> *content;
+	int         lastOffset = -1;
+
 	static KeysWidget* create (Module *module) {
 		KeysWidget *w = new KeysWidget();
 		w->box.pos  = mm2px (Vec (0, 0));
 		w->box.size = mm2px (Vec (10, 120));
+		w->content->box.size = w->box.size;
 		w->module   = (Mother *)(module);
 
 		return w;
@@ -893,11 +1192,13 @@ struct KeysWidget : TransparentWidget {
 		Constructor
 	*/
 	KeysWidget () {
+		content = new CachedContent<KeysWidget> ();
+		content->owner = this;
+		addChild (content);
 	}
 
-	void draw (const DrawArgs &drawArgs) override { 
+	void step () override {
 		int offset;		
-		int whites = 0b101010110101;
 		if (module) {
 			if (module->getStateJson(C_BASED_DISPLAY_JSON) == 1.0f) 
 				offset = 0;
@@ -910,6 +1211,16 @@ struct KeysWidget : TransparentWidget {
 		}
 		else
 			offset = 0;
+		if (offset != lastOffset) {
+			lastOffset = offset;
+			dirty = true;
+		}
+		FramebufferWidget::step ();
+	}
+
+	void drawContent (const DrawArgs &drawArgs) {
+		int offset = lastOffset;
+		int whites = 0b101010110101;
 		for (int i = offset + NUM_NOTES; i > offset; i--) {
 			NVGcolor white = nvgRGB(255, 255, 255);
 			NVGcolor black = nvgRGB(0, 0, 0);
@@ -941,20 +1252,15 @@ struct MotherWidget : ModuleWidget {
         RoundSmallBlackKnob *knob;
 		LargeLight<RedGreenBlueLight> *light;
         setModule (module);
+#if OL_TRACE
+		if (module)
+			addChild (new TraceWidget (module, &module->OL_traceRing, "Mother"));
+#endif
 		setPanel (APP->window->loadSvg(asset::plugin (pluginInstance, "res/Mother.svg")));
 
 		if (module) {
-			SvgPanel *brightPanel = new SvgPanel();
-			brightPanel->setBackground(APP->window->loadSvg(asset::plugin(pluginInstance, "res/MotherBright.svg")));
-			brightPanel->visible = false;
-			
-			module->brightPanel = brightPanel;
-			addChild(brightPanel);
-			SvgPanel *darkPanel = new SvgPanel();
-			darkPanel->setBackground(APP->window->loadSvg(asset::plugin(pluginInstance, "res/MotherDark.svg")));
-			darkPanel->visible = false;
-			module->darkPanel = darkPanel;
-			addChild(darkPanel);
+			addChild (StylePanel::create (box.size, &module->getStateJson (STYLE_JSON), STYLE_BRIGHT, "res/MotherBright.svg"));
+			addChild (StylePanel::create (box.size, &module->getStateJson (STYLE_JSON), STYLE_DARK,   "res/MotherDark.svg"));
 		}
 		keysWidget = KeysWidget::create(module);
 		addChild (keysWidget);
@@ -1003,7 +1309,7 @@ struct MotherWidget : ModuleWidget {
 		const char *text;
 
 		text = (module != nullptr ? module->headDisplayText : nullptr);
-		headWidget = TextWidget::create (mm2px (Vec(3.183 - 0.25 - 0.35, 128.5 - 115.271)), module, text, "Major", 12, (module ? &(module->headScrollTimer) : nullptr));
+		headWidget = TextWidget::create (mm2px (Vec(3.183 - 0.25 - 0.35, 128.5 - 115.271)), module, text, "Major", 12, (module ? &(module->headTextVersion) : nullptr));
 		headWidget->pStyle = (module == nullptr ? nullptr : &(module->OL_state[STYLE_JSON]));
 		addChild (headWidget);
 
@@ -1044,8 +1350,8 @@ struct MotherWidget : ModuleWidget {
 				scaleItem = new MotherScaleItem ();
 				scaleItem->module = module;
 				scaleItem->scaleIdx = scale;
-				scaleItem->text = module->scaleNames[scale];
-				scaleItem->rightText = module->scaleKeys[scale];
+				scaleItem->text = Mother::scaleNames[scale];
+				scaleItem->rightText = Mother::scaleKeys[scale];
 
 				menu->addChild(scaleItem);
 			}
@@ -1102,7 +1408,6 @@ struct MotherWidget : ModuleWidget {
 		int style;
 		void onAction(const event::Action &e) override {
 			module->OL_setOutState(STYLE_JSON, float(style));
-			module->styleChanged = true;
 		}
 		void step() override {
 			if (module)
@@ -24,6 +24,7 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #define NUM_NOTES   12
 #define NUM_SCALES  12
 #define NUM_CHLD    NUM_NOTES
+#define NUM_MASKS   (1 << NUM_NOTES)	// All combinations of notes on in a scale, bit n is note n
 #define SEMITONE    (1.f / 12.f)
 
 #define SECOND                  44100
@@ -41,6 +42,18 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #define CHG_CV_IN   (1 << 5)
 #define CHG_TRG_IN  (1 << 6)
 
+#define FATE_CACHE_SIZE 16	// Fate search results cached per instance, power of 2
+#define FATE_SHAPE_SIZE 1024	// Segments of the fate shape curve table, linear interpolation error < 2e-5
+
+#define CV_CHANGE_THRESHOLD 0.001f	// 1 mV, far below a semitone, ignores noise on cv inputs (cv mode change detection only)
+
+#define DMD_FATE    1		// Fate search, feeds CV_OUTPUT, GATE_OUTPUT, POW_OUTPUT and the visualization
+
+#define TRC_TRIGGER      1	// Fate search triggered, value = cv in
+#define TRC_CANDIDATES   2	// Number of candidate notes found (pCnt)
+#define TRC_NOTE         3	// Chosen cv out
+#define TRC_PROBABILITY  4	// Probability of the chosen note
+
 //
 // Defaults
 //
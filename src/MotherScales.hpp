@@ -20,7 +20,7 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 */
 #define SCALE_KEYS  42
 
-    const char *scaleKeys[SCALE_KEYS]  = { 
+    static constexpr const char *scaleKeys[SCALE_KEYS]  = { 
         "2212221",      "2122212",      "1222122",      "2221221",      "2212212",      "2122122",      "1221222",
         "2221212",      "1212222",      "313131" ,      "22122111",     "321132",       "111111111111", 
         "1322211",      "1312131",      "2131122",      "2121222",      "2212131",      "2122131",      "42141",
@@ -29,7 +29,7 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
         "1311231",      "1312122",      "222312",       "311223",       "132132",       "114114",       "2131212",
         "222222",     
     };
-	const char *scaleNames[SCALE_KEYS] = {
+	static constexpr const char *scaleNames[SCALE_KEYS] = {
         "Major",        "Dorian",       "Phrygian",     "Lydian",       "Myxolodian",   "Aeolian - natural Minor",   "Locrian",
         "Acoustic",     "Altered",      "Augmented",    "Bebop dom.",   "Blues",        "Chromatic", 
         "Enigmatic",    "Flamenco",     "Gypsy",        "Half diminished",    "harmonic Major",  "harmonic Minor",  "Hirajoshi",
@@ -24,3 +24,10 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "plugin.hpp"
 #include "OrangeLine.hpp"
 
+/**
+	Font used by all OrangeLine widgets, resolved once per plugin
+*/
+std::shared_ptr<Font> orangeLineFont () {
+	static std::shared_ptr<Font> font = APP->window->loadFont (asset::plugin (pluginInstance, "res/repetition-scrolling.regular.ttf"));
+	return font;
+}
@@ -22,6 +22,7 @@ You should have received a copy of the GNU General Public License
 along with this program.  If not, see <https://www.gnu.org/licenses/>.
 */
 #include <math.h>
+#include <chrono>
 
 #ifndef ORANGE_LINE_HPP
 #define ORANGE_LINE_HPP
@@ -50,10 +51,59 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #define PRECISION       0.000001f
 
 #define IDLESKIP	32
+#define PARAM_POLL_SLICE	4	// Params polled per processed sample, all params are polled every NUM_PARAMS / PARAM_POLL_SLICE samples
+
+#define UI_REFLECT_INTERVAL	(1.0 / 60.0)	//	Seconds between reflections of lights, the UI draws at about 60 Hz
+
+/*
+	Event trace, build with FLAGS += -DOL_TRACE=1 to have modules log events
+	into a lock free ring buffer drained to OrangeLine-trace.log in the user folder by the UI thread
+*/
+#ifndef OL_TRACE
+#define OL_TRACE	0
+#endif
+#define TRACE_SIZE	1024	// Must be a power of 2
+
+#if OL_TRACE
+#define traceEvent(type, channel, value)	OL_traceRing.push (OL_frame, (type), (channel), float(value))
+#else
+#define traceEvent(type, channel, value)	do { (void)(channel); (void)(value); } while (0)
+#endif
+
+/*
+	Random seed, build with FLAGS += -DOL_USE_FIXED_SEED to seed random generators with OL_FIXED_SEED
+	instead of the time of reset, so outputs are reproducible sample by sample.
+	Any seed can be chosen with FLAGS += -DOL_FIXED_SEED=<seed>, 0 included
+*/
+#ifndef OL_FIXED_SEED
+#define OL_FIXED_SEED	0
+#endif
+
+/*
+	Latency instrumentation, build with FLAGS += -DOL_LATENCY=1 to measure the samples from the sample
+	an edge on a latency input is detected (after the Schmitt trigger) to the sample the module responds
+	on a latency output, i.e. reflects a state change of it, whether or not the voltage changed.
+	A measurement without response within the latency window (0: the sample of the edge) is abandoned.
+	Measurements go to a histogram per module and, when tracing, to the trace as TRC_LATENCY events.
+	Add one sample for the cable between two modules.
+*/
+#ifndef OL_LATENCY
+#define OL_LATENCY	0
+#endif
+#define LATENCY_BINS	64	// One bin per sample, the last bin collects all larger latencies
+#define TRC_LATENCY		0	// Trace type reserved for latency, module types start at 1
+
+#define setLatencyInput(i)		(OL_latencyInput[i] = true)
+#define setLatencyOutput(i)		(OL_latencyOutput[i] = true)
+#define setLatencyWindow(v)		(OL_latencyWindow = (v))	// Samples a module may delay its response to an edge
+#define getLatencyAbandoned()	OL_latencyAbandoned
+#define getLatencyHistogram(i)	OL_latencyHistogram[i]
+#define getLastLatency()		OL_lastLatency
 
 #define MAX_TEXT_SIZE  64
-#define TEXT_SCROLL_DELAY   22050
-#define TEXT_SCROLL_PRE_DELAY   TEXT_SCROLL_DELAY * 4
+#define TEXT_BASELINE  mm2px (5)	// Baseline of text widgets, text is drawn inside the widget's box
+#define TEXT_SCROLL_DELAY       0.5		// Seconds between scroll steps of text widgets
+#define TEXT_SCROLL_PRE_DELAY   (TEXT_SCROLL_DELAY * 4)	// Seconds new text is shown unscrolled
 
 #define stateIdxJson(i)			(i)
 #define stateIdxParam(i)		(NUM_JSONS + (i))
@@ -105,6 +155,10 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #define setCustomChangeMaskParam(i, v)	setCustomChangeMask((i), (v))
 #define setCustomChangeMaskInput(i, v)	setCustomChangeMask(NUM_PARAMS + (i), (v))
 
+#define setChangeThresholdInput(i, v)	OL_setChangeThreshold ((i), (v), OL_changeUlps[i])
+#define setChangeUlpsInput(i, v)	OL_setChangeThreshold ((i), OL_changeThreshold[i], (v))
+#define inputChanged(i, o, v)		OL_inputChanged ((i), (o), (v))
+
 #define setInPoly(i, v)			(OL_isPoly[i] = (v))
 #define setOutPoly(i, v)		(OL_isPoly[NUM_INPUTS + i] = (v))
 #define getInPoly(i)			OL_isPoly[i]
@@ -119,8 +173,15 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #define customChangeBits		OL_customChangeBits
 
 #define isGate(i)			OL_isGate[i]
+#define getOutputConnected(i)		OL_outputConnected[i]
+
+#define getDemandMaskOutput(i)		OL_demandMask[i]
+#define setDemandMaskOutput(i, v)	(OL_demandMask[i] = (v))
+#define demandBits			OL_demandBits
+#define demandRaisedBits		OL_demandRaisedBits
 #define getInputConnected(i)		OL_inputConnected[i]
 #define initialized			OL_initialized
+#define uiReflect			OL_uiReflect
 
 #define quantize(CV)			(round (CV * 12.f) / 12.f)
 #define octave(CV)			int(floor (quantize (CV)))
@@ -144,6 +205,16 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 	pq->label = pLabel; \
 }
 
+/*
+	Profiling counters, read them using getProfileCounter (PROFILE_...)
+*/
+#define PROFILE_OUTPUT_WRITES		0	//	Voltages and channel counts written to Rack's output ports
+#define PROFILE_OUTPUT_WRITES_AVOIDED	1	//	Writes skipped because the port already holds the value
+#define NUM_PROFILE_COUNTERS		2
+
+#define getProfileCounter(i)		OL_profileCounter[i]
+#define countProfile(i)			(OL_profileCounter[i] ++)
+
 #define N 624
 #define M 397
 #define MATRIX_A 0x9908b0dfUL   /* constant vector a */
@@ -155,10 +226,65 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 	Widgets
 */
 
+/**
+	Font used by all OrangeLine widgets, resolved once per plugin
+*/
+std::shared_ptr<Font> orangeLineFont ();
+
+/**
+	Panel of an alternative style
+	Takes its place in the widget tree when the module widget is created,
+	but the svg is only loaded when its style gets selected for the first time.
+	Follows the style json state on the UI thread.
+*/
+struct StylePanel : Widget {
+
+	float      *pStyle = nullptr;
+	int         style  = STYLE_ORANGE;
+	const char *svg    = nullptr;
+	SvgPanel   *panel  = nullptr;
+
+	static StylePanel* create (Vec size, float *pStyle, int style, const char *svg) {
+		StylePanel *w = new StylePanel();
+
+		w->box.size = size;
+		w->pStyle   = pStyle;
+		w->style    = style;
+		w->svg      = svg;
+		w->visible  = false;
+
+		return w;
+	}
+
+	void step () override {
+		visible = (int(*pStyle) == style);
+		if (visible && panel == nullptr) {
+			panel = new SvgPanel ();
+			panel->setBackground (APP->window->loadSvg (asset::plugin (pluginInstance, svg)));
+			addChild (panel);
+		}
+		Widget::step ();
+	}
+};
+
+/**
+	Child of a cached widget, draws the content of its parent into the parent's framebuffer
+*/
+template <class T>
+struct CachedContent : TransparentWidget {
+
+	T *owner = nullptr;
+
+	void draw (const DrawArgs &drawArgs) override {
+		owner->drawContent (drawArgs);
+	}
+};
+
 /**
 	Widget to display cvOct values as floats or notes
+	Cached in a framebuffer, only redrawn when value or style change
 */
-struct NumberWidget : TransparentWidget {
+struct NumberWidget : FramebufferWidget {
 
 	std::shared_ptr<Font> pFont;
 
@@ -170,12 +296,18 @@ struct NumberWidget : TransparentWidget {
 	float       defaultValue = 0.f;
 	float	   *pStyle = nullptr;
 
+	CachedContent<NumberWidget> *content;
+	float       lastValue = NAN;
+	float       lastStyle = NAN;
+
 	static NumberWidget* create (Vec pos, Module *module, float *pValue, float defaultValue, const char *format, char *buffer, int length) {
 		NumberWidget *w = new NumberWidget();
 
-		w->pFont    = APP->window->loadFont(asset::plugin(pluginInstance, "res/repetition-scrolling.regular.ttf"));
+		w->pFont    = orangeLineFont ();
 		w->box.pos  = pos;
+		w->box.pos.y  -= TEXT_BASELINE;
 		w->box.size = mm2px (Vec (4 * length, 7));
+		w->content->box.size = w->box.size;
 		w->module   = module;
 		w->pValue   = pValue;
 		w->format   = format;
@@ -188,23 +320,37 @@ struct NumberWidget : TransparentWidget {
 		Constructor
 	*/
 	NumberWidget () {
+		content = new CachedContent<NumberWidget> ();
+		content->owner = this;
+		addChild (content);
 	}
 
-	void draw (const DrawArgs &drawArgs) override {
+	void step () override {
+		float value = pValue != nullptr ? *pValue : defaultValue;
+		float style = pStyle != nullptr ? *pStyle : STYLE_ORANGE;
+		if (value != lastValue || style != lastStyle) {
+			lastValue = value;
+			lastStyle = style;
+			dirty = true;
+		}
+		FramebufferWidget::step ();
+	}
+
+	void drawContent (const DrawArgs &drawArgs) {
 		nvgFontFaceId (drawArgs.vg, pFont->handle);
 		nvgFontSize (drawArgs.vg, 18);
-		nvgFillColor (drawArgs.vg, (pStyle == nullptr || *pStyle == STYLE_ORANGE) ? ORANGE : WHITE);
-		float value = pValue != nullptr ? *pValue : defaultValue;
-		snprintf (buffer, length + 1, format, value);
+		nvgFillColor (drawArgs.vg, lastStyle == STYLE_ORANGE ? ORANGE : WHITE);
+		snprintf (buffer, length + 1, format, lastValue);
 		buffer[length] = '\0';
-		nvgText (drawArgs.vg, 0, 0, buffer, nullptr);
+		nvgText (drawArgs.vg, 0, TEXT_BASELINE, buffer, nullptr);
 	}
 };
 
 /**
 	Widget to display cvOct values as floats or notes
+	Cached in a framebuffer, only redrawn when text, scroll position or style change
 */
-struct TextWidget : TransparentWidget {
+struct TextWidget : FramebufferWidget {
 
 	std::shared_ptr<Font> pFont;
 
@@ -212,23 +358,30 @@ struct TextWidget : TransparentWidget {
 	const char *text   = nullptr;
 	int	    length = 0;
 	int	    scrollPos = 0;
-	int	   *pTimer;
+	double	    scrollTime = 0.;	// UI time the next scroll step is due
+	unsigned long *pVersion = nullptr;	// Changed by the module when new text should scroll from its start
+	unsigned long  lastVersion = 0;
 	const char *defaultText = nullptr;
 	float	   *pStyle = nullptr;
-	bool	    reset = false;
 
-	static TextWidget* create (Vec pos, Module *module, const char *text, const char * defaultText, int length, int *pTimer) {
+	CachedContent<TextWidget> *content;
+	char	    lastText[MAX_TEXT_SIZE + 1] = "";
+	int	    lastScrollPos = -1;
+	float	    lastStyle = NAN;
+
+	static TextWidget* create (Vec pos, Module *module, const char *text, const char * defaultText, int length, unsigned long *pVersion) {
 		TextWidget *w = new TextWidget();
 
-		w->pFont    = APP->window->loadFont(asset::plugin(pluginInstance, "res/repetition-scrolling.regular.ttf"));
+		w->pFont    = orangeLineFont ();
 		w->box.pos  = pos;
-		w->box.pos.y  -= mm2px (5);
+		w->box.pos.y  -= TEXT_BASELINE;
 		w->box.size = mm2px (Vec (4 * length, 7));
+		w->content->box.size = w->box.size;
 		w->module   = module;
 		w->text     = text;
 		w->defaultText  = defaultText;
 		w->length   = length;
-		w->pTimer   = pTimer;
+		w->pVersion = pVersion;
 
 		return w;
 	}
@@ -237,47 +390,153 @@ struct TextWidget : TransparentWidget {
 		Constructor
 	*/
 	TextWidget () {
+		content = new CachedContent<TextWidget> ();
+		content->owner = this;
+		addChild (content);
 	}
 
-	void draw (const DrawArgs &drawArgs) override {
-		const char *delimiter = " - ";
-		char buf[MAX_TEXT_SIZE * 2 + 1 + 3 /* delimiter length */];
+	void step () override {
         	const char* str = (text != nullptr ? text : defaultText);
 		int len = strlen(str);
 		if (len > MAX_TEXT_SIZE)
 			len = MAX_TEXT_SIZE;
+		/*
+			Scrolling is driven by the UI clock, the module only publishes a new version of its text
+		*/
+		if (pVersion != nullptr) {
+			double now = std::chrono::duration<double> (std::chrono::steady_clock::now ().time_since_epoch ()).count ();
+			if (*pVersion != lastVersion) {
+				lastVersion = *pVersion;
+				scrollPos = 0;
+				scrollTime = now + TEXT_SCROLL_PRE_DELAY;
+			}
+			if (len > length && now >= scrollTime) {
+				scrollPos = (scrollPos + 1) % (len + 3);
+				scrollTime = now + TEXT_SCROLL_DELAY;
+			}
+		}
+		float style = pStyle != nullptr ? *pStyle : STYLE_ORANGE;
+		if (style != lastStyle || scrollPos != lastScrollPos || strncmp (str, lastText, MAX_TEXT_SIZE) != 0) {
+			strncpy (lastText, str, MAX_TEXT_SIZE);
+			lastText[MAX_TEXT_SIZE] = '\0';
+			lastScrollPos = scrollPos;
+			lastStyle = style;
+			dirty = true;
+		}
+		FramebufferWidget::step ();
+	}
+
+	void drawContent (const DrawArgs &drawArgs) {
+		const char *delimiter = " - ";
+		char buf[MAX_TEXT_SIZE * 2 + 1 + 3 /* delimiter length */];
+		int len = strlen (lastText);
 		nvgFontFaceId (drawArgs.vg, pFont->handle);
 		nvgFontSize (drawArgs.vg, 18);
-		nvgFillColor (drawArgs.vg, (pStyle == nullptr || *pStyle == STYLE_ORANGE) ? ORANGE : WHITE);
+		nvgFillColor (drawArgs.vg, lastStyle == STYLE_ORANGE ? ORANGE : WHITE);
 
 		if (len <= length) {
-			nvgText (drawArgs.vg, 0, mm2px (5), str, nullptr);
+			nvgText (drawArgs.vg, 0, TEXT_BASELINE, lastText, nullptr);
 		}
 		else {
-			if (pTimer != nullptr && len > length) {
-				if (*pTimer <= 0) {
-					*pTimer = TEXT_SCROLL_DELAY;
-					scrollPos = (scrollPos + 1) % (len + 3);
-				}
-				else {
-					if (*pTimer > TEXT_SCROLL_DELAY) {
-						if (!reset) {
-							reset = true;
-							scrollPos = 0;
-						}
-					}
-					else {
-						reset = false;
-					}
-				}
-			}
-			strncpy (buf, str, len);
+			strncpy (buf, lastText, len);
 			strcpy (buf + len, delimiter);
-			strncpy (buf + len + 3 /* delimiter length */, str, len);
+			strncpy (buf + len + 3 /* delimiter length */, lastText, len);
 			buf[MAX_TEXT_SIZE * 2 + 3] = '\0';
 			buf[scrollPos + length] = '\0';
-			nvgText (drawArgs.vg, 0, mm2px (5), buf + scrollPos, nullptr);
+			nvgText (drawArgs.vg, 0, TEXT_BASELINE, buf + scrollPos, nullptr);
+		}
+	}
+};
+
+// ********************************************************************************************************************************
+/**
+	Event trace
+*/
+
+struct TraceEvent {
+	unsigned long frame;	// Sample the event was logged in
+	int type;				// Module specific event type, see TRC_* in the module's .hpp
+	int channel;
+	float value;
+};
+
+/**
+	Single producer single consumer ring buffer
+	Pushed by the audio thread, popped by the UI thread, no allocation and no locks.
+	Events pushed into a full ring are dropped and counted.
+*/
+struct TraceRing {
+	TraceEvent event[TRACE_SIZE];
+	std::atomic<unsigned int> head {0};		// Written by the producer only
+	std::atomic<unsigned int> tail {0};		// Written by the consumer only
+	std::atomic<unsigned int> dropped {0};
+
+	bool push (unsigned long frame, int type, int channel, float value) {
+		unsigned int h = head.load (std::memory_order_relaxed);
+		if (h - tail.load (std::memory_order_acquire) >= TRACE_SIZE) {
+			dropped.fetch_add (1, std::memory_order_relaxed);
+			return false;
+		}
+		TraceEvent &e = event[h & (TRACE_SIZE - 1)];
+		e.frame   = frame;
+		e.type    = type;
+		e.channel = channel;
+		e.value   = value;
+		head.store (h + 1, std::memory_order_release);
+		return true;
+	}
+
+	bool pop (TraceEvent &e) {
+		unsigned int t = tail.load (std::memory_order_relaxed);
+		if (t == head.load (std::memory_order_acquire))
+			return false;
+		e = event[t & (TRACE_SIZE - 1)];
+		tail.store (t + 1, std::memory_order_release);
+		return true;
+	}
+};
+
+/**
+	Invisible widget draining the trace of a module into OrangeLine-trace.log
+	One line per event: module name, module id, frame, type, channel, value
+*/
+struct TraceWidget : Widget {
+	Module     *module;
+	TraceRing  *ring;
+	const char *name;
+	FILE       *file;
+	unsigned int dropped = 0;
+
+	TraceWidget (Module *module, TraceRing *ring, const char *name) {
+		this->module = module;
+		this->ring   = ring;
+		this->name   = name;
+		file = fopen (asset::user ("OrangeLine-trace.log").c_str (), "a");
+	}
+
+	~TraceWidget () {
+		if (file != nullptr)
+			fclose (file);
+	}
+
+	void step () override {
+		Widget::step ();
+		if (file == nullptr)
+			return;
+		TraceEvent e;
+		bool written = false;
+		while (ring->pop (e)) {
+			fprintf (file, "%s %d %lu %d %d %g\n", name, module->id, e.frame, e.type, e.channel, e.value);
+			written = true;
+		}
+		unsigned int d = ring->dropped.load (std::memory_order_relaxed);
+		if (d != dropped) {
+			fprintf (file, "%s %d dropped %u events\n", name, module->id, d - dropped);
+			dropped = d;
+			written = true;
 		}
+		if (written)
+			fflush (file);
 	}
 };
 
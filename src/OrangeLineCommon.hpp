@@ -34,9 +34,12 @@ char  OL_stateType      [NUM_STATES];	//	type of state variable char used as tin
 bool  OL_inStateChange  [NUM_STATES];	//	flags to control processing for incoming state changes
 bool  OL_outStateChange [NUM_STATES];	//	flags to control reflection for outgoing state changes
 bool  OL_inputConnected [NUM_INPUTS];	//	flags to remember connected inputs
-char  *OL_jsonLabel     [NUM_JSONS];	//	lables of json state properties
+const char * const *OL_jsonLabel = nullptr;	//	lables of json state properties, shared table of the module
 unsigned long OL_customChangeMask[NUM_PARAMS + NUM_INPUTS];	// bitmask to speed up change detection in process
 unsigned long OL_customChangeBits = 0;		// change bits set based on OL_customChangeMasks
+float OL_changeThreshold[NUM_INPUTS];	// inputs must move more than this many volts to be changed, 0 = any change
+int   OL_changeUlps     [NUM_INPUTS];	// inputs must move more than this many ulps to be changed, 0 = any change
+bool  OL_changeResync   [NUM_INPUTS];	// threshold was lowered, accept the next value of the input unconditionally
 dsp::SchmittTrigger *OL_inStateTrigger  [NUM_TRIGGERS];	//	trigger objects for param (buttons) and inputs (triggers)
 dsp::PulseGenerator *OL_outStateTrigger [NUM_OUTPUTS];	//	pulse generator objects for outputs (triggers)
 bool OL_isGate [NUM_OUTPUTS];
@@ -44,6 +47,25 @@ bool OL_wasTriggered [NUM_OUTPUTS];		// remember whether we triggered once at al
 bool OL_isPoly[NUM_INPUTS + NUM_OUTPUTS];
 int  OL_polyChannels[NUM_OUTPUTS];
 
+/*
+	Output publishing cache
+	Remembers what has been written to Rack's output ports, so reflectChanges () only touches them on real changes
+*/
+bool  OL_outputConnected   [NUM_OUTPUTS];					//	flags to remember connected outputs
+int   OL_publishedChannels [NUM_OUTPUTS];					//	channel count last set on the output port, -1 = unknown
+float OL_publishedVoltage  [NUM_OUTPUTS * POLY_CHANNELS];	//	voltage last set on the output port, NAN = unknown
+
+unsigned long OL_profileCounter[NUM_PROFILE_COUNTERS];		//	profiling counters, see PROFILE_... in OrangeLine.hpp
+
+/*
+	Output demand
+	Modules declare which of their computations feed an output by setDemandMaskOutput () in moduleInitStateTypes ()
+	and skip computations without a connected consumer
+*/
+unsigned long OL_demandMask[NUM_OUTPUTS];	//	bitmask of module computations feeding the output
+unsigned long OL_demandBits = 0;			//	computations feeding at least one connected output
+unsigned long OL_demandRaisedBits = 0;		//	computations demanded now but not in the previous process () run
+
 /*
 	Poly data
 */
@@ -55,13 +77,12 @@ bool  OL_outStateChangePoly [NUM_OUTPUTS * POLY_CHANNELS];	//	flags to control r
 bool  OL_wasTriggeredPoly   [NUM_OUTPUTS * POLY_CHANNELS];	// remember whether we triggered once at all only set when triggerd but never reset
 
 
-double OL_sampleTime;
+double OL_sampleTime = 0.;
 bool   OL_initialized = false;
+int    OL_paramPollIdx = 0;		// next param to be polled by processParamsAndInputs ()
 
-bool   styleChanged = true;
-
-SvgPanel *brightPanel;
-SvgPanel *darkPanel;
+double OL_uiReflectTime = 0.;	//	Audio time passed since lights have been reflected
+bool   OL_uiReflect = true;		//	Lights are reflected in this process () run
 
 const char *channelNumbers[16] = {
 	"1", "2", "3", "4", "5", "6", "7", "8", "9", "10", "11", "12", "13", "14", "15", "16"
@@ -69,6 +90,22 @@ const char *channelNumbers[16] = {
 
 int    idleSkipCounter = 0;
 int    samplesSkipped  = 0;
+unsigned long OL_frame = 0;		// Samples since the module was created, skipped ones included
+
+#if OL_TRACE
+TraceRing OL_traceRing;
+#endif
+
+bool OL_latencyInput [NUM_INPUTS];		// Edges on these inputs start a latency measurement
+bool OL_latencyOutput[NUM_OUTPUTS];		// Responses on these outputs end it
+unsigned long OL_latencyWindow = 0;		// Samples after the edge a response is accepted
+#if OL_LATENCY
+unsigned long OL_latencyEdgeFrame = 0;
+bool          OL_latencyPending = false;
+unsigned long OL_latencyAbandoned = 0;	// Edges without response within the window
+unsigned long OL_latencyHistogram[LATENCY_BINS];
+unsigned long OL_lastLatency = 0;
+#endif
 /*
 	Got random implementation from Frozen Wastland Seeds of Change
 */
@@ -179,6 +216,15 @@ float normal_number() {
 inline void initializeInstance () {
 	memset (          OL_isPoly, false, sizeof (OL_isPoly));	// Must be before initStateTypes ()!
 	memset (OL_customChangeMask,    0L, sizeof (OL_customChangeMask));	// Initialie customChangeMasks to 0s
+	memset (      OL_demandMask,    0L, sizeof (OL_demandMask));		// Initialie demandMasks to 0s
+	memset ( OL_changeThreshold,   0.f, sizeof (OL_changeThreshold));	// Initialie change thresholds to any change
+	memset (      OL_changeUlps,     0, sizeof (OL_changeUlps));
+	memset (    OL_changeResync, false, sizeof (OL_changeResync));
+	memset (    OL_latencyInput, false, sizeof (OL_latencyInput));
+	memset (   OL_latencyOutput, false, sizeof (OL_latencyOutput));
+#if OL_LATENCY
+	memset (OL_latencyHistogram,     0, sizeof (OL_latencyHistogram));
+#endif
 
 	initStateTypes ();			//	Initialize state types to defaults
 	moduleInitStateTypes ();	//	Method to overwrite defaults by module specific settings 
@@ -195,6 +241,10 @@ inline void initializeInstance () {
 	memset (  OL_inStateChangePoly, false, sizeof (OL_inStateChangePoly));
 	memset ( OL_outStateChangePoly, false, sizeof (OL_outStateChangePoly));
 	memset (   OL_wasTriggeredPoly, false, sizeof (OL_wasTriggeredPoly));
+
+	memset (    OL_outputConnected, false, sizeof (OL_outputConnected));
+	memset (     OL_profileCounter,     0, sizeof (OL_profileCounter));
+	invalidatePublishedOutputs ();
 	/*
 		Now we call moduleReset () to ensure that a valid json state is created before this constructor
 		returns.
@@ -267,11 +317,33 @@ inline void allocateTriggers () {
 	}
 }
 
+/**
+	Forget everything published to the output ports, next reflectChanges () writes unconditionally
+*/
+inline void invalidatePublishedOutputs () {
+	for (int outputIdx = 0; outputIdx < NUM_OUTPUTS; outputIdx++)
+		OL_publishedChannels[outputIdx] = -1;
+	for (int idx = 0; idx < NUM_OUTPUTS * POLY_CHANNELS; idx++)
+		OL_publishedVoltage[idx] = NAN;
+}
+
 /**
 	Method to configure json labels
+	labels is a table of NUM_JSONS labels shared by all instances of the module
+*/
+inline void setJsonLabels (const char * const *labels) {
+	OL_jsonLabel = labels;
+}
+
+/**
+	Look up a json label in the first count labels, -1 if not found
+	Modules with generated labels can decode them in moduleJsonIdx () instead
 */
-inline void setJsonLabel (int idx, char *label) {
-	OL_jsonLabel[idx] = label;
+inline int findJsonIdx (const char *label, int count = NUM_JSONS) {
+	for (int jsonIdx = 0; jsonIdx < count; jsonIdx ++)
+		if (!strcmp (label, OL_jsonLabel[jsonIdx]))
+			return jsonIdx;
+	return -1;
 }
 
 // ********************************************************************************************************************************
@@ -311,6 +383,46 @@ inline void OL_setInState (int stateIdx, float value) {
 		OL_outStateChange[stateIdx] = OL_inStateChange[stateIdx] = true;
 	}
 }
+/**
+	Distance of two floats in units in the last place
+*/
+inline long long OL_ulpDistance (float a, float b) {
+	uint32_t ua, ub;
+	memcpy (&ua, &a, sizeof (ua));
+	memcpy (&ub, &b, sizeof (ub));
+	//	map sign magnitude to a continuous integer scale, -0 and +0 both map to 0
+	long long la = (ua & 0x80000000) ? -(long long)(ua & 0x7fffffff) : (long long)ua;
+	long long lb = (ub & 0x80000000) ? -(long long)(ub & 0x7fffffff) : (long long)ub;
+	return la > lb ? la - lb : lb - la;
+}
+/**
+	Set the change thresholds of an input
+	When a threshold gets lowered, the last accepted value may be off by more than the new threshold,
+	so the next value of the input is accepted unconditionally
+*/
+inline void OL_setChangeThreshold (int inputIdx, float threshold, int ulps) {
+	if (threshold < OL_changeThreshold[inputIdx] || ulps < OL_changeUlps[inputIdx])
+		OL_changeResync[inputIdx] = true;
+	OL_changeThreshold[inputIdx] = threshold;
+	OL_changeUlps[inputIdx] = ulps;
+}
+/**
+	Check whether an input value is a change compared to the last accepted value
+	Thresholds are measured against the last accepted value, not the last sample.
+	So noise around a value never adds up to a change (hysteresis), while slow movements do
+	as soon as they leave the threshold.
+*/
+inline bool OL_inputChanged (int inputIdx, float oldValue, float value) {
+	if (oldValue == value)
+		return false;
+	if (OL_changeResync[inputIdx])
+		return true;
+	if (OL_changeThreshold[inputIdx] > 0.f && fabs (value - oldValue) <= OL_changeThreshold[inputIdx])
+		return false;
+	if (OL_changeUlps[inputIdx] > 0 && OL_ulpDistance (oldValue, value) <= OL_changeUlps[inputIdx])
+		return false;
+	return true;
+}
 /**
 	Method to set the outgoing state of params
 	output state change is flagged
@@ -321,6 +433,94 @@ inline void OL_setOutState (int stateIdx, float value) {
 		OL_outStateChange[stateIdx] = true;
 	}
 }
+/**
+	Write a voltage to an output port channel only if it differs from the last one written
+*/
+inline void OL_publishVoltage (int outputIdx, int channel, float value) {
+	int idx = outputIdx * POLY_CHANNELS + channel;
+	if (!OL_outputConnected[outputIdx]) {
+		countProfile (PROFILE_OUTPUT_WRITES_AVOIDED);	//	published when connected again
+		return;
+	}
+	if (OL_publishedVoltage[idx] != value) {	//	NAN never compares equal, so unknown values are always written
+		OL_publishedVoltage[idx] = value;
+		outputs[outputIdx].setVoltage (value, channel);
+		countProfile (PROFILE_OUTPUT_WRITES);
+	}
+	else
+		countProfile (PROFILE_OUTPUT_WRITES_AVOIDED);
+}
+/**
+	Latency instrumentation, an edge on a latency input starts a measurement, a new edge abandons a pending one
+*/
+inline void OL_latencyEdge (int inputIdx) {
+#if OL_LATENCY
+	if (OL_latencyInput[inputIdx]) {
+		if (OL_latencyPending)
+			OL_latencyAbandoned ++;
+		OL_latencyEdgeFrame = OL_frame;
+		OL_latencyPending = true;
+	}
+#endif
+}
+/**
+	Latency instrumentation, the first response on a latency output within the window ends the measurement.
+	Called when a state change of the output is reflected, also if the voltage did not change or the output is not connected
+*/
+inline void OL_latencyResponse (int outputIdx) {
+#if OL_LATENCY
+	if (OL_latencyPending && OL_latencyOutput[outputIdx] && OL_frame - OL_latencyEdgeFrame <= OL_latencyWindow) {
+		OL_latencyPending = false;
+		OL_lastLatency = OL_frame - OL_latencyEdgeFrame;
+		OL_latencyHistogram[OL_lastLatency < LATENCY_BINS ? OL_lastLatency : LATENCY_BINS - 1] ++;
+		traceEvent (TRC_LATENCY, outputIdx, OL_lastLatency);
+	}
+#endif
+}
+/**
+	Latency instrumentation, abandon a measurement without response at the end of its window,
+	so a later unrelated response can not close it
+*/
+inline void OL_latencyExpire () {
+#if OL_LATENCY
+	if (OL_latencyPending && OL_frame - OL_latencyEdgeFrame >= OL_latencyWindow) {
+		OL_latencyPending = false;
+		OL_latencyAbandoned ++;
+	}
+#endif
+}
+/**
+	Set the channel count of an output port only if it differs from the last one set
+*/
+inline void OL_publishChannels (int outputIdx, int channels) {
+	if (OL_outputConnected[outputIdx] && OL_publishedChannels[outputIdx] != channels) {
+		/*
+			Rack zeroes voltages of channels dropped by setChannels ()
+		*/
+		for (int channel = channels; channel < POLY_CHANNELS; channel++)
+			OL_publishedVoltage[outputIdx * POLY_CHANNELS + channel] = NAN;
+		OL_publishedChannels[outputIdx] = channels;
+		outputs[outputIdx].setChannels (channels);
+		countProfile (PROFILE_OUTPUT_WRITES);
+	}
+	else
+		countProfile (PROFILE_OUTPUT_WRITES_AVOIDED);
+}
+/**
+	Check whether the current value of an output port channel is known to be published
+*/
+inline bool OL_isPublished (int outputIdx, int channel) {
+	return !std::isnan (OL_publishedVoltage[outputIdx * POLY_CHANNELS + channel]);
+}
+/**
+	Voltage of a trigger output in its current state, inverted in gate mode once triggered
+*/
+inline float OL_triggerVoltage (int outputIdx, float state, bool wasTriggered) {
+	bool trgActive = state > 0.f;
+	if (OL_isGate[outputIdx] && wasTriggered)
+		trgActive = !trgActive;
+	return trgActive ? 10.f : 0.f;
+}
 /**
 	Method to configure json labels
 */
@@ -338,6 +538,7 @@ inline NVGcolor getTextColor () {
 */
 void process (const ProcessArgs &args) override {
 
+	OL_frame ++;
 	bool skip = moduleSkipProcess();
 	idleSkipCounter = (idleSkipCounter + 1) % IDLESKIP;
 	if (skip) {
@@ -346,14 +547,22 @@ void process (const ProcessArgs &args) override {
 		return;
 	}
 
-	OL_sampleTime = 1.0 / (double)(APP->engine->getSampleRate ());
+	/*
+		Take the sample rate from the engine's process arguments, not from APP->engine.
+		No shared engine object is touched per sample, so instances scale across engine threads
+		and the audio path runs without a UI or engine context, e.g. in a headless host
+	*/
+	OL_sampleTime = 1.0 / (double)(args.sampleRate);
 
 	initialize ();
 	processParamsAndInputs ();
+	processOutputDemand ();
+	processUiReflect ();
 	moduleProcessState ();
 	moduleProcess (args);
 	moduleReflectChanges ();
 	reflectChanges();
+	OL_latencyExpire ();
 
 	OL_initialized = true;
 	samplesSkipped = 0;
@@ -403,7 +612,7 @@ inline void initialize () {
 	}
 	else {
 		moduleInitialize ();
-		styleChanged = true;
+		invalidatePublishedOutputs ();
 	}
 	
 	//	We set OL_initialized to true at the end of process () 
@@ -418,8 +627,19 @@ inline void processParamsAndInputs () {
 
 	/*
 		Process Params
+		Knobs and buttons move at human rate, so we only poll a slice of PARAM_POLL_SLICE params per call
+		round robin to keep the cost per sample independent of the number of params.
+		Trigger params still see every value polled, so a button press is never missed.
+		While initializing we poll them all.
 	*/
-	for (int stateIdx = stateIdxParam (0), paramIdx = 0; stateIdx <= maxStateIdxParam; stateIdx++, paramIdx++) {
+	int pollCount = OL_initialized ? PARAM_POLL_SLICE : NUM_PARAMS;
+	if (pollCount > NUM_PARAMS)
+		pollCount = NUM_PARAMS;
+	for (int poll = 0; poll < pollCount; poll++) {
+		int paramIdx = OL_paramPollIdx;
+		int stateIdx = stateIdxParam (paramIdx);
+		if (++OL_paramPollIdx >= NUM_PARAMS)
+			OL_paramPollIdx = 0;
 		if (getStateTypeParam (paramIdx) == STATE_TYPE_TRIGGER) {
 			/*
 				For triggers we do not use setInStateParam (), 
@@ -479,12 +699,13 @@ inline void processParamsAndInputs () {
 					if (((dsp::SchmittTrigger*)OL_inStateTriggerPoly[idx])->process (OL_statePoly[idx])) {
 						OL_inStateChangePoly[idx] = true;
 						OL_customChangeBits |= getCustomChangeMaskInput (inputIdx);
+						OL_latencyEdge (inputIdx);
 					}
 				}
 				else {
 					float value = inputs[inputIdx].getVoltage (channel);
 					if (!std::isfinite(value)) value = 0.f;
-					if (OL_statePoly[idx] != value) {
+					if (OL_inputChanged (inputIdx, OL_statePoly[idx], value)) {
 						OL_statePoly[idx] = value;
 						OL_inStateChangePoly[idx] = true;
 						OL_customChangeBits |= getCustomChangeMaskInput (inputIdx);
@@ -512,6 +733,7 @@ inline void processParamsAndInputs () {
 				if (((dsp::SchmittTrigger*)OL_inStateTrigger[NUM_PARAMS + inputIdx])->process (OL_state[stateIdx])) {
 					OL_inStateChange[stateIdx] = true;
 					OL_customChangeBits |= getCustomChangeMaskInput (inputIdx);
+					OL_latencyEdge (inputIdx);
 				}
 			}
 			else { 
@@ -519,14 +741,52 @@ inline void processParamsAndInputs () {
 				if (!std::isfinite(value)) value = 0.f;
 				// Do not clamp because some modules might have to deal with lower and larger values
 				// value = clamp(value, -10.f, 10.f);
-				setStateInput (inputIdx, value);
-				if (changeInput(inputIdx))
+				if (OL_inputChanged (inputIdx, getStateInput (inputIdx), value)) {
+					setStateInput (inputIdx, value);
 					OL_customChangeBits |= getCustomChangeMaskInput (inputIdx);
+				}
 			}
 		}
+		OL_changeResync[inputIdx] = false;
 	}
 }
 
+/**
+	Check which outputs are connected and derive the demanded module computations
+	Outputs getting connected are invalidated to have reflectChanges () publish their current state
+*/
+inline void processOutputDemand () {
+	unsigned long lastDemandBits = OL_demandBits;
+	OL_demandBits = 0;
+	for (int outputIdx = 0; outputIdx < NUM_OUTPUTS; outputIdx++) {
+		bool connected = outputs[outputIdx].isConnected ();
+		if (connected != OL_outputConnected[outputIdx]) {
+			/*
+				Rack resets the channel count of an output when a cable is plugged in or out
+			*/
+			OL_outputConnected[outputIdx] = connected;
+			OL_publishedChannels[outputIdx] = -1;
+			for (int channel = 0; channel < POLY_CHANNELS; channel++)
+				OL_publishedVoltage[outputIdx * POLY_CHANNELS + channel] = NAN;
+		}
+		if (connected)
+			OL_demandBits |= OL_demandMask[outputIdx];
+	}
+	OL_demandRaisedBits = OL_demandBits & ~lastDemandBits;
+}
+
+/**
+	Decide whether lights are reflected in this process () run
+	Lights are only looked at by the UI, so they are reflected at UI frame rate.
+	Based on audio time, so it is independent from sample rate and IDLESKIP
+*/
+inline void processUiReflect () {
+	OL_uiReflectTime += OL_sampleTime * (1 + samplesSkipped);
+	OL_uiReflect = !OL_initialized || OL_uiReflectTime >= UI_REFLECT_INTERVAL;
+	if (OL_uiReflect)
+		OL_uiReflectTime = 0.;
+}
+
 /**
     Output processing of active triggers
 */
@@ -551,7 +811,7 @@ inline void processActiveOutputTriggers () {
 						OL_statePoly[NUM_INPUTS * POLY_CHANNELS + cvOutPolyIdx] = 0.f;
 					if (OL_isGate[outputIdx] && OL_wasTriggeredPoly[cvOutPolyIdx])
 						trgActive = !trgActive;
-					outputs[outputIdx].setVoltage (trgActive ? 10.f : 0.f, channel);
+					OL_publishVoltage (outputIdx, channel, trgActive ? 10.f : 0.f);
 				}
 			}
 		}
@@ -569,7 +829,7 @@ inline void processActiveOutputTriggers () {
 					setStateOutput (outputIdx, 0.f);
 				if (OL_isGate[outputIdx] && OL_wasTriggered[outputIdx])
 					trgActive = !trgActive;
-				outputs[outputIdx].setVoltage (trgActive ? 10.f : 0.f);
+				OL_publishVoltage (outputIdx, 0, trgActive ? 10.f : 0.f);
 			}
 		}
 	}
@@ -603,8 +863,9 @@ inline void reflectChanges () {
 			for (channel = 0; channel < getOutPolyChannels (outputIdx); channel++) {
 				int cvOutPolyIdx = outputIdx * POLY_CHANNELS + channel;
 				if (OL_outStateChangePoly [cvOutPolyIdx]) {
+					OL_latencyResponse (outputIdx);
 					if (getStateTypeOutput (outputIdx) == STATE_TYPE_VOLTAGE) {
-						outputs[outputIdx].setVoltage (OL_statePoly[NUM_INPUTS * POLY_CHANNELS + cvOutPolyIdx], channel);    
+						OL_publishVoltage (outputIdx, channel, OL_statePoly[NUM_INPUTS * POLY_CHANNELS + cvOutPolyIdx]);
 					}
 					else	// OL_stateType[stateIdx + channel] == STATE_TYPE_TRIGGER
 						((dsp::PulseGenerator*)(OL_outStateTriggerPoly[cvOutPolyIdx]))->trigger (0.001f);
@@ -622,15 +883,25 @@ inline void reflectChanges () {
 						OL_statePoly[NUM_INPUTS * POLY_CHANNELS + cvOutPolyIdx] = 0.f;
 					if (OL_isGate[outputIdx] && OL_wasTriggeredPoly[cvOutPolyIdx])
 						trgActive = !trgActive;
-					outputs[outputIdx].setVoltage (trgActive ? 10.f : 0.f, channel);
+					OL_publishVoltage (outputIdx, channel, trgActive ? 10.f : 0.f);
+				}
+				/*
+					Output (re)connected, publish its current state
+				*/
+				if (!OL_isPublished (outputIdx, channel)) {
+					if (getStateTypeOutput (outputIdx) == STATE_TYPE_VOLTAGE)
+						OL_publishVoltage (outputIdx, channel, OL_statePoly[NUM_INPUTS * POLY_CHANNELS + cvOutPolyIdx]);
+					else
+						OL_publishVoltage (outputIdx, channel, OL_triggerVoltage (outputIdx, OL_statePoly[NUM_INPUTS * POLY_CHANNELS + cvOutPolyIdx], OL_wasTriggeredPoly[cvOutPolyIdx]));
 				}
 			}
-			outputs[outputIdx].setChannels(channel);
+			OL_publishChannels (outputIdx, channel);
 		}
 		else {
 			if (changeOutput (outputIdx)) {
+				OL_latencyResponse (outputIdx);
 				if (getStateTypeOutput (outputIdx) == STATE_TYPE_VOLTAGE) {
-					outputs[outputIdx].setVoltage (getStateOutput (outputIdx));    
+					OL_publishVoltage (outputIdx, 0, getStateOutput (outputIdx));
 				}
 				else	// OL_stateType[stateIdx] == STATE_TYPE_TRIGGER
 					((dsp::PulseGenerator*)(OL_outStateTrigger[outputIdx]))->trigger (0.001f);
@@ -648,15 +919,26 @@ inline void reflectChanges () {
 					setStateOutput (outputIdx, 0.f);
 				if (OL_isGate[outputIdx] && OL_wasTriggered[outputIdx])
 					trgActive = !trgActive;
-				outputs[outputIdx].setVoltage (trgActive ? 10.f : 0.f);
+				OL_publishVoltage (outputIdx, 0, trgActive ? 10.f : 0.f);
+			}
+			/*
+				Output (re)connected, publish its current state
+			*/
+			if (!OL_isPublished (outputIdx, 0)) {
+				if (getStateTypeOutput (outputIdx) == STATE_TYPE_VOLTAGE)
+					OL_publishVoltage (outputIdx, 0, getStateOutput (outputIdx));
+				else
+					OL_publishVoltage (outputIdx, 0, OL_triggerVoltage (outputIdx, getStateOutput (outputIdx), OL_wasTriggered[outputIdx]));
 			}
 		}
 	}
 	/*
 		Process Lights
+		Only at UI frame rate, light changes in between are coalesced
+		Params are still reflected immediately, because processParamsAndInputs () reads them back
 	*/
-	for (int stateIdx = stateIdxLight (0), lightIdx = 0; stateIdx <= maxStateIdxLight; stateIdx ++, lightIdx++) {
-		if (!OL_initialized || changeLight (lightIdx)) {
+	if (OL_uiReflect) {
+		for (int stateIdx = stateIdxLight (0), lightIdx = 0; stateIdx <= maxStateIdxLight; stateIdx ++, lightIdx++) {
 			lights[lightIdx].value = getStateLight (lightIdx) / 255.f;
 		}
 	}
@@ -684,10 +966,13 @@ json_t *dataToJson () override {
 	Restore json state values after loading a preset or (re)loading a patch
 */
 void dataFromJson (json_t *rootJ) override {
+	const char *label;
 	json_t *pJson;
-	for (int jsonIdx = 0; jsonIdx < NUM_JSONS; jsonIdx ++)
-		if ((pJson = json_object_get (rootJ, OL_jsonLabel[jsonIdx])) != nullptr)
+	int jsonIdx;
+	json_object_foreach (rootJ, label, pJson) {
+		if ((jsonIdx = moduleJsonIdx (label)) >= 0)
 			setStateJson (jsonIdx, json_real_value (pJson));
+	}
 
 	OL_initialized = false;	//  indiacte that we have to reinitialize
 }
@@ -697,6 +982,5 @@ void dataFromJson (json_t *rootJ) override {
 */
 void onReset () override {
 	moduleReset ();
-	styleChanged = true;
 	OL_initialized = false;	//	Request initialize
 }
\ No newline at end of file
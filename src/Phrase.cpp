@@ -47,6 +47,25 @@ struct Phrase : Module {
 	int   oldClockDelayCounter = 0;
 	int   oldMasterDelayCounter = 0;
 
+	/*
+		Json labels shared by all Phrase instances, in order of jsonIds
+	*/
+	static constexpr const char *jsonLabel[NUM_JSONS] = {
+		"style",				//	STYLE_JSON
+		"reset",				//	RESET_JSON
+		"phraseLenCouter",		//	PHRASELENCOUNTER_JSON
+		"phraseDurCounter",		//	PHRASEDURCOUNTER_JSON
+		"slaveLenCounter",		//	SLAVELENCOUNTER_JSON
+		"slavePattern",			//	SLAVEPATTERN_JSON
+		"masterDelayCounter",	//	MASTERDELAYCOUNTER_JSON
+		"trowaFix",				//	TROWAFIX_JSON
+		"divCounter",			//	DIVCOUNTER_JSON
+		"clockDelayCounter",	//	CLOCKDELAYCOUNTER_JSON
+		"clockWithReset",		//	CLOCKWITHRESET_JSON
+		"clockWithSpa",			//	CLOCKWITHSPA_JSON
+		"clockWithSph",			//	CLOCKWITHSPH_JSON
+	};
+
 
 // ********************************************************************************************************************************
 /*
@@ -97,35 +116,21 @@ struct Phrase : Module {
 		setStateTypeOutput (SPA_OUTPUT, STATE_TYPE_TRIGGER);
 		setStateTypeOutput (SLAVE_RST_OUTPUT, STATE_TYPE_TRIGGER);
 		setStateTypeOutput (SLAVE_CLK_OUTPUT, STATE_TYPE_TRIGGER);
+
+		setLatencyInput  (CLK_INPUT);
+		setLatencyOutput (MASTER_CLK_OUTPUT);
+		setLatencyOutput (SLAVE_CLK_OUTPUT);
+		setLatencyWindow (LATENCY_BINS - 1);	// Response and slave clock delays of up to 32 samples each
 	}
 
 	/**
 		Initialize json configuration by defining the lables used form json state variables
 	*/
 	inline void moduleInitJsonConfig () {
-
-		#pragma GCC diagnostic push 
-		#pragma GCC diagnostic ignored "-Wwrite-strings"
-
 		//
 		// Config internal Parameters not bound to a user interface object
 		//
-
-		setJsonLabel (STYLE_JSON, "style");
-		setJsonLabel (RESET_JSON, "reset");
-		setJsonLabel (PHRASELENCOUNTER_JSON, "phraseLenCouter");
-		setJsonLabel (PHRASEDURCOUNTER_JSON, "phraseDurCounter");
-		setJsonLabel (SLAVELENCOUNTER_JSON, "slaveLenCounter");
-		setJsonLabel (SLAVEPATTERN_JSON, "slavePattern");
-		setJsonLabel (MASTERDELAYCOUNTER_JSON, "masterDelayCounter");
-		setJsonLabel (TROWAFIX_JSON, "trowaFix");
-		setJsonLabel (DIVCOUNTER_JSON, "divCounter");
-		setJsonLabel (CLOCKDELAYCOUNTER_JSON, "clockDelayCounter");
-		setJsonLabel (CLOCKWITHRESET_JSON, "clockWithReset");
-		setJsonLabel (CLOCKWITHSPA_JSON, "clockWithSpa");
-		setJsonLabel (CLOCKWITHSPH_JSON, "clockWithSph");
-
-		#pragma GCC diagnostic pop
+		setJsonLabels (jsonLabel);
 
 		setStateJson (STYLE_JSON, float(STYLE_ORANGE));
 		setStateJson (RESET_JSON, 0.f);
@@ -142,6 +147,13 @@ struct Phrase : Module {
 		setStateJson (CLOCKWITHSPH_JSON, 0.f);
 	}
 
+	/**
+		Get the json index of a json label, -1 if unknown
+	*/
+	inline int moduleJsonIdx (const char *label) {
+		return findJsonIdx (label);
+	}
+
 	/**
 		Initialize param configs
 	*/
@@ -164,7 +176,6 @@ struct Phrase : Module {
 		or a right click initialize (reset).
 	*/
 	inline void moduleInitialize () {
-		styleChanged = true;
 	}
 
 	/**
@@ -195,26 +206,6 @@ struct Phrase : Module {
 /*
 	Methods called directly or indirectly called from process () in OrangeLineCommon.hpp
 */
-	void handleStyleChange () {
-		if (styleChanged) {
-			switch (int(getStateJson (STYLE_JSON))) {
-				case STYLE_ORANGE:
-					brightPanel->visible = false;
-					darkPanel->visible = false;
-					break;
-				case STYLE_BRIGHT:
-					brightPanel->visible = true;
-					darkPanel->visible = false;
-					break;
-				case STYLE_DARK:
-					brightPanel->visible = false;
-					darkPanel->visible = true;
-					break;
-			}
-			styleChanged = false;
-		}
-	}
-
 	/*
 		(Re)Start the phrase pattern
 	*/
@@ -379,7 +370,6 @@ struct Phrase : Module {
 			defaultPhraseLen = (getStateParam (LEN_PARAM) * getStateParam(DIV_PARAM)) / 100.f;
 		setStateOutput (ELEN_OUTPUT, defaultPhraseLen);
 
-		handleStyleChange ();
 		checkDeferredProcessMaster();
 		checkDeferredClockSlave ();
 
@@ -389,14 +379,20 @@ struct Phrase : Module {
 
         if (changeInput (CLK_INPUT)) {
 			processPendingReset ();
-			if (phraseDurCounter == 0)
+			if (phraseDurCounter == 0) {
+				traceEvent (TRC_PHRASE_END, 0, phraseLenCounter);
 				clockMaster ();
+			}
 			else {
-				if (phraseLenCounter == 0)
+				if (phraseLenCounter == 0) {
+					traceEvent (TRC_PHRASE_START, 0, phraseDurCounter);
 					startPhrasePattern ();
+				}
 				else {
-					if (slaveLenCounter == 0) 
+					if (slaveLenCounter == 0) {
 						advancePhrasePattern ();
+						traceEvent (TRC_PATTERN_ADVANCE, 0, slavePattern);
+					}
 				}
 				slaveLenCounter--;
 				phraseLenCounter--;
@@ -443,6 +439,8 @@ struct Phrase : Module {
 	}
 };
 
+constexpr const char *Phrase::jsonLabel[NUM_JSONS];
+
 // ********************************************************************************************************************************
 /*
 	Module widget implementation
@@ -456,19 +454,15 @@ struct PhraseWidget : ModuleWidget {
 	PhraseWidget(Phrase *module) {
 
 		setModule (module);
+#if OL_TRACE
+		if (module)
+			addChild (new TraceWidget (module, &module->OL_traceRing, "Phrase"));
+#endif
 		setPanel (APP->window->loadSvg(asset::plugin (pluginInstance, "res/PhraseOrange.svg")));
 
 		if (module) {
-			SvgPanel *brightPanel = new SvgPanel();
-			brightPanel->setBackground(APP->window->loadSvg(asset::plugin(pluginInstance, "res/PhraseBright.svg")));
-			brightPanel->visible = false;
-			module->brightPanel = brightPanel;
-			addChild(brightPanel);
-			SvgPanel *darkPanel = new SvgPanel();
-			darkPanel->setBackground(APP->window->loadSvg(asset::plugin(pluginInstance, "res/PhraseDark.svg")));
-			darkPanel->visible = false;
-			module->darkPanel = darkPanel;
-			addChild(darkPanel);
+			addChild (StylePanel::create (box.size, &module->getStateJson (STYLE_JSON), STYLE_BRIGHT, "res/PhraseBright.svg"));
+			addChild (StylePanel::create (box.size, &module->getStateJson (STYLE_JSON), STYLE_DARK,   "res/PhraseDark.svg"));
 		}
 
 		addInput (createInputCentered<PJ301MPort>   (mm2px (Vec (  3.575 + 4.2 , /* 128.5 - */ 10.874 + 4.2)),  module, RST_INPUT));
@@ -513,7 +507,6 @@ struct PhraseWidget : ModuleWidget {
 		int style;
 		void onAction(const event::Action &e) override {
 			module->OL_setOutState(STYLE_JSON, float(style));
-			module->styleChanged = true;
 		}
 		void step() override {
 			if (module)
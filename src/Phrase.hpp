@@ -23,6 +23,10 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #define CHG_RST_IN		1
 #define CHG_CLK_IN		(1 << 1)
 
+#define TRC_PHRASE_END		1	// Phrase duration rolled over, master gets clocked
+#define TRC_PHRASE_START	2	// Phrase length rolled over, phrase pattern restarts
+#define TRC_PATTERN_ADVANCE	3	// Slave length rolled over, value = next slave pattern
+
 #define MIN_INC			-10.
 #define MAX_INC			10.
 #define DEFAULT_INC		0.31746
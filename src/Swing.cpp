@@ -41,6 +41,13 @@ struct Swing : Module {
     bool    tClkFired = true;
 	int		tClkDelay = -1;
 
+	/*
+		Json labels shared by all Swing instances, in order of jsonIds
+	*/
+	static constexpr const char *jsonLabel[NUM_JSONS] = {
+		"style",				//	STYLE_JSON
+	};
+
 // ********************************************************************************************************************************
 /*
 	Initialization
@@ -72,23 +79,28 @@ struct Swing : Module {
 
      	setStateTypeOutput (ECLK_OUTPUT, STATE_TYPE_TRIGGER);
      	setStateTypeOutput (TCLK_OUTPUT, STATE_TYPE_TRIGGER);
+
+		setLatencyInput  (  CLK_INPUT);
+		setLatencyOutput (ECLK_OUTPUT);
+		setLatencyOutput (TCLK_OUTPUT);
+		setLatencyWindow (LATENCY_BINS - 1);	// Swung clocks respond late, longer delays are abandoned
 	}
 
 	/**
 		Initialize json configuration by defining the lables used form json state variables
 	*/
 	inline void moduleInitJsonConfig () {
-
-		#pragma GCC diagnostic push 
-		#pragma GCC diagnostic ignored "-Wwrite-strings"
-
 		//
 		// Config internal Parameters not bound to a user interface object
 		//
+		setJsonLabels (jsonLabel);
+	}
 
-		setJsonLabel (      STYLE_JSON, "style");
-
-		#pragma GCC diagnostic pop
+	/**
+		Get the json index of a json label, -1 if unknown
+	*/
+	inline int moduleJsonIdx (const char *label) {
+		return findJsonIdx (label);
 	}
 
 	/**
@@ -123,7 +135,6 @@ struct Swing : Module {
 		Currently called twice when add a module to patch ...
 	*/
 	void moduleReset () {
-		styleChanged = true;
 	}
 
 // ********************************************************************************************************************************
@@ -139,23 +150,6 @@ struct Swing : Module {
 		Module specific process method called from process () in OrangeLineCommon.hpp
 	*/
 	inline void moduleProcess (const ProcessArgs &args) {
-		if (styleChanged) {
-			switch (int(getStateJson(STYLE_JSON))) {
-				case STYLE_ORANGE:
-					brightPanel->visible = false;
-					darkPanel->visible = false;
-					break;
-				case STYLE_BRIGHT:
-					brightPanel->visible = true;
-					darkPanel->visible = false;
-					break;
-				case STYLE_DARK:
-					brightPanel->visible = false;
-					darkPanel->visible = true;
-					break;
-			}
-			styleChanged = false;
-		}
 
         if (getInputConnected (BPM_INPUT)) {
             if (changeInput (BPM_INPUT) || changeParam (DIV_PARAM) || phaseStep == 0.f)
@@ -226,6 +220,8 @@ struct Swing : Module {
 	}
 };
 
+constexpr const char *Swing::jsonLabel[NUM_JSONS];
+
 // ********************************************************************************************************************************
 /*
 	Module widget implementation
@@ -247,16 +243,8 @@ struct SwingWidget : ModuleWidget {
 		setPanel (APP->window->loadSvg(asset::plugin (pluginInstance, "res/Swing.svg")));
 
 		if (module) {
-			SvgPanel *brightPanel = new SvgPanel();
-			brightPanel->setBackground(APP->window->loadSvg(asset::plugin(pluginInstance, "res/SwingBright.svg")));
-			brightPanel->visible = false;
-			module->brightPanel = brightPanel;
-			addChild(brightPanel);
-			SvgPanel *darkPanel = new SvgPanel();
-			darkPanel->setBackground(APP->window->loadSvg(asset::plugin(pluginInstance, "res/SwingDark.svg")));
-			darkPanel->visible = false;
-			module->darkPanel = darkPanel;
-			addChild(darkPanel);
+			addChild (StylePanel::create (box.size, &module->getStateJson (STYLE_JSON), STYLE_BRIGHT, "res/SwingBright.svg"));
+			addChild (StylePanel::create (box.size, &module->getStateJson (STYLE_JSON), STYLE_DARK,   "res/SwingDark.svg"));
 		}
 
 
@@ -303,7 +291,6 @@ struct SwingWidget : ModuleWidget {
 		int style;
 		void onAction(const event::Action &e) override {
 			module->OL_setOutState(STYLE_JSON, float(style));
-			module->styleChanged = true;
 		}
 		void step() override {
 			if (module)
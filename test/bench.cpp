@@ -0,0 +1,131 @@
+/*
+	bench.cpp
+
+	Benchmark of OrangeLine modules with many instances
+
+	Runs N instances of a scenario for M samples, N = 1, 2, 4, ... up to -n, and reports the time per sample.
+	Every sample processes all instances before the next sample, round robin like the Rack engine does.
+	With -t the instances are split across threads, each thread processes its instances for all samples.
+	Time per instance rising with N shows when the instances' state no longer fits into the caches.
+
+	Usage: bench [-s samples] [-n instances] [-t threads] [scenario ...]
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#include <chrono>
+#include <cstdlib>
+#include <thread>
+
+#include "harness.hpp"
+
+#define WARMUP_SAMPLES	4096	// Samples run before timing, modules are initialized and the scenario setup is done
+
+void init (Plugin *p);
+
+static const char *defaultScenarios[] = { "fence_trg", "mother_trg", "phrase_master_slave", "swing_bpm" };
+
+struct Instance {
+	Module *module;
+	Script script;
+};
+
+/**
+	Process samples [from, to) for the instances [begin, end)
+*/
+static void run (std::vector<Instance> &instances, size_t begin, size_t end, long from, long to) {
+	Module::ProcessArgs args { HARNESS_SAMPLE_RATE, 1.f / HARNESS_SAMPLE_RATE };
+	for (long frame = from; frame < to; frame ++)
+		for (size_t i = begin; i < end; i ++) {
+			instances[i].script (instances[i].module, frame);
+			instances[i].module->process (args);
+		}
+}
+
+/**
+	Time samples for count instances of a scenario split across threads, returns seconds
+*/
+static double measure (Scenario &scenario, int count, int threads, long samples) {
+	std::vector<Instance> instances;
+	for (int i = 0; i < count; i ++)
+		instances.push_back (Instance { createModule (scenario), scenario.script () });
+
+	run (instances, 0, instances.size (), 0, WARMUP_SAMPLES);
+
+	auto start = std::chrono::steady_clock::now ();
+	if (threads <= 1)
+		run (instances, 0, instances.size (), WARMUP_SAMPLES, WARMUP_SAMPLES + samples);
+	else {
+		std::vector<std::thread> workers;
+		for (int t = 0; t < threads; t ++) {
+			size_t begin = instances.size () * t / threads;
+			size_t end   = instances.size () * (t + 1) / threads;
+			workers.push_back (std::thread (run, std::ref (instances), begin, end, long(WARMUP_SAMPLES), WARMUP_SAMPLES + samples));
+		}
+		for (auto &worker : workers)
+			worker.join ();
+	}
+	double seconds = std::chrono::duration<double> (std::chrono::steady_clock::now () - start).count ();
+
+	for (auto &instance : instances)
+		delete instance.module;
+	return seconds;
+}
+
+int main (int argc, char **argv) {
+	long samples = long(HARNESS_SAMPLE_RATE);
+	int maxInstances = 512;
+	int threads = 1;
+	std::vector<std::string> names;
+
+	for (int i = 1; i < argc; i ++) {
+		std::string arg = argv[i];
+		if (arg == "-s" && i + 1 < argc)
+			samples = atol (argv[++ i]);
+		else if (arg == "-n" && i + 1 < argc)
+			maxInstances = atoi (argv[++ i]);
+		else if (arg == "-t" && i + 1 < argc)
+			threads = atoi (argv[++ i]);
+		else if (arg[0] == '-') {
+			fprintf (stderr, "usage: %s [-s samples] [-n instances] [-t threads] [scenario ...]\n", argv[0]);
+			return 2;
+		}
+		else
+			names.push_back (arg);
+	}
+	if (names.empty ())
+		names.assign (std::begin (defaultScenarios), std::end (defaultScenarios));
+
+	init (new Plugin);
+
+	printf ("%-20s %9s %7s %12s %12s %10s\n", "scenario", "instances", "threads", "ns/sample", "ns/instance", "dsp load");
+	for (auto &name : names) {
+		Scenario *scenario = findScenario (name);
+		if (scenario == nullptr) {
+			fprintf (stderr, "unknown scenario %s\n", name.c_str ());
+			return 2;
+		}
+		for (int count = 1; count <= maxInstances; count *= 2) {
+			int t = threads < count ? threads : count;
+			double seconds = measure (*scenario, count, t, samples);
+			double perSample = seconds / samples;
+			/*
+				dsp load is the share of the real time budget of a sample at 44.1 kHz, like Rack's cpu meter
+			*/
+			printf ("%-20s %9d %7d %12.1f %12.2f %9.1f%%\n", name.c_str (), count, t,
+					perSample * 1e9, perSample * 1e9 / count, perSample * HARNESS_SAMPLE_RATE * 100.);
+			fflush (stdout);
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,100 @@
+/*
+	fence.cpp
+
+	Test harness scenarios for the OrangeLine module Fence
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#include "harness.hpp"
+#include "Fence.hpp"
+
+#define FENCE_CHANNELS	4
+
+/**
+	Stepped cv per channel, semitones and fractions of them from -4V to 4V
+*/
+static float fenceCv (long frame, int channel) {
+	long step = frame / 50 + channel * 7;
+	return float((step * 13) % 97) / 12.f - 4.f + float(step % 5) * 0.013f;
+}
+
+/*
+	Poly cv sampled by a poly trigger, channels triggered at 100 Hz with different phases
+*/
+static ScenarioRegistration fenceTrg ("fence_trg", &modelFence, 44100, shared ([] (Module *module, long frame) {
+	if (frame == 0) {
+		connect (module->inputs[CV_INPUT], FENCE_CHANNELS);
+		connect (module->inputs[TRG_INPUT], FENCE_CHANNELS);
+	}
+	for (int channel = 0; channel < FENCE_CHANNELS; channel ++) {
+		module->inputs[CV_INPUT].setVoltage (fenceCv (frame, channel), channel);
+		module->inputs[TRG_INPUT].setVoltage (pulse (frame + channel * 37, 441), channel);
+	}
+}));
+
+/*
+	Poly cv in every mode and link state, without trigger
+	Each scenario clicks mode and link into place, sets the knobs and moves low and high knob later on
+*/
+#define FENCE_FRAMES	12000
+
+struct FenceKnobs {
+	float low, high, step;
+};
+
+static const char *modeNames[] = { "raw", "qtz", "shpr" };
+static const char *linkNames[] = { "none", "range", "center" };
+
+static const FenceKnobs fenceKnobs[] = {
+	{ -1.5f, 2.f, 0.5f },			// raw
+	{ SEMITONE * 2, 1.5f, SEMITONE * 7 },	// qtz
+	{ -2.f, 2.f, 0.1f },			// shpr
+};
+static const float defaultLink[] = { DEFAULT_LINK_RAW, DEFAULT_LINK_QTZ, DEFAULT_LINK_SHPR };
+
+static Script fenceModeLink (int mode, int link) {
+	int modeClicks = (mode - int(DEFAULT_MODE) + 3) % 3;
+	int linkClicks = (link - int(defaultLink[mode]) + 3) % 3;
+	long linkStart = afterButton (modeClicks, BUTTON_SAMPLES);
+	long setup = afterButton (linkClicks, linkStart) + BUTTON_SAMPLES;
+	FenceKnobs knobs = fenceKnobs[mode];
+
+	return [=] (Module *module, long frame) {
+		if (frame == 0)
+			connect (module->inputs[CV_INPUT], 2);
+		module->params[MODE_PARAM].setValue (button (frame, modeClicks, BUTTON_SAMPLES));
+		module->params[LINK_PARAM].setValue (button (frame, linkClicks, linkStart));
+		if (frame == setup) {
+			module->params[LOW_PARAM].setValue (knobs.low);
+			module->params[HIGH_PARAM].setValue (knobs.high);
+			module->params[STEP_PARAM].setValue (knobs.step);
+		}
+		if (frame == FENCE_FRAMES / 2)
+			module->params[LOW_PARAM].setValue (knobs.low + 0.75f);
+		if (frame == FENCE_FRAMES * 3 / 4)
+			module->params[HIGH_PARAM].setValue (knobs.high + 0.5f);
+		for (int channel = 0; channel < 2; channel ++)
+			module->inputs[CV_INPUT].setVoltage (fenceCv (frame, channel), channel);
+	};
+}
+
+static struct FenceModeLinkRegistration {
+	FenceModeLinkRegistration () {
+		for (int mode = MODE_RAW_INT; mode <= MODE_SHPR_INT; mode ++)
+			for (int link = LINK_NONE_INT; link <= LINK_CENTER_INT; link ++) {
+				std::string name = std::string ("fence_") + modeNames[mode] + "_" + linkNames[link];
+				ScenarioRegistration (name.c_str (), &modelFence, FENCE_FRAMES, shared (fenceModeLink (mode, link)));
+			}
+	}
+} fenceModeLinkRegistration;
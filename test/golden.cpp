@@ -0,0 +1,141 @@
+/*
+	golden.cpp
+
+	Golden output runner of the OrangeLine test harness
+
+	Runs each scenario for its number of samples and records every change of an output, one line per change:
+
+		<frame> <output> <channel> <voltage>	voltage of a channel changed
+		<frame> <output> channels <channels>	number of channels changed
+
+	"check" compares the recording to <dir>/<scenario>.txt and reports the first difference,
+	"write" (re)creates the golden files after an intended change of module behavior.
+	Modules have to be built with a fixed random seed, see OL_USE_FIXED_SEED in OrangeLine.hpp.
+
+	Usage: golden check|write <dir> [scenario ...]
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#include <fstream>
+
+#include "harness.hpp"
+
+void init (Plugin *p);
+
+/**
+	Run a scenario and return the recorded output changes
+*/
+static std::vector<std::string> record (Scenario &scenario) {
+	std::vector<std::string> lines;
+	Module *module = createModule (scenario);
+	Script script = scenario.script ();
+	Module::ProcessArgs args { HARNESS_SAMPLE_RATE, 1.f / HARNESS_SAMPLE_RATE };
+
+	std::vector<Output> last (module->outputs.size ());
+	char line[64];
+	for (long frame = 0; frame < scenario.frames; frame ++) {
+		script (module, frame);
+		module->process (args);
+		for (size_t i = 0; i < module->outputs.size (); i ++) {
+			Output &output = module->outputs[i];
+			if (frame == 0 || output.channels != last[i].channels) {
+				snprintf (line, sizeof (line), "%ld %zu channels %d", frame, i, output.channels);
+				lines.push_back (line);
+			}
+			for (int channel = 0; channel < output.channels; channel ++)
+				if (frame == 0 || output.voltages[channel] != last[i].voltages[channel]) {
+					snprintf (line, sizeof (line), "%ld %zu %d %.6g", frame, i, channel, output.voltages[channel]);
+					lines.push_back (line);
+				}
+			last[i] = output;
+		}
+	}
+	delete module;
+	return lines;
+}
+
+/**
+	Write a recording to its golden file
+*/
+static bool writeGolden (const std::string &path, const std::vector<std::string> &lines) {
+	std::ofstream file (path);
+	for (auto &line : lines)
+		file << line << "\n";
+	return bool(file);
+}
+
+/**
+	Compare a recording to its golden file, returns false and prints the first difference if they differ
+*/
+static bool checkGolden (const std::string &path, const std::vector<std::string> &lines) {
+	std::ifstream file (path);
+	if (!file) {
+		printf ("  no golden file %s\n", path.c_str ());
+		return false;
+	}
+	std::string expected;
+	size_t n = 0;
+	for (; std::getline (file, expected); n ++) {
+		if (n >= lines.size ()) {
+			printf ("  line %zu: expected \"%s\", got end of output\n", n + 1, expected.c_str ());
+			return false;
+		}
+		if (lines[n] != expected) {
+			printf ("  line %zu: expected \"%s\", got \"%s\"\n", n + 1, expected.c_str (), lines[n].c_str ());
+			return false;
+		}
+	}
+	if (n < lines.size ()) {
+		printf ("  line %zu: expected end of output, got \"%s\"\n", n + 1, lines[n].c_str ());
+		return false;
+	}
+	return true;
+}
+
+int main (int argc, char **argv) {
+	if (argc < 3 || (std::string (argv[1]) != "check" && std::string (argv[1]) != "write")) {
+		fprintf (stderr, "usage: %s check|write <dir> [scenario ...]\n", argv[0]);
+		return 2;
+	}
+	bool writing = std::string (argv[1]) == "write";
+	std::string dir = argv[2];
+
+	std::vector<Scenario *> selected;
+	for (int i = 3; i < argc; i ++) {
+		Scenario *scenario = findScenario (argv[i]);
+		if (scenario == nullptr) {
+			fprintf (stderr, "unknown scenario %s\n", argv[i]);
+			return 2;
+		}
+		selected.push_back (scenario);
+	}
+	if (selected.empty ())
+		for (auto &scenario : scenarios ())
+			selected.push_back (&scenario);
+
+	init (new Plugin);
+
+	int failed = 0;
+	for (auto scenario : selected) {
+		std::string path = dir + "/" + scenario->name + ".txt";
+		std::vector<std::string> lines = record (*scenario);
+		bool ok = writing ? writeGolden (path, lines) : checkGolden (path, lines);
+		printf ("%-24s %s (%zu changes)\n", scenario->name.c_str (), ok ? (writing ? "written" : "ok") : "FAILED", lines.size ());
+		if (!ok)
+			failed ++;
+	}
+	if (failed)
+		printf ("%d of %zu scenarios failed\n", failed, selected.size ());
+	return failed ? 1 : 0;
+}
@@ -0,0 +1,38 @@
+/*
+	harness.cpp
+
+	Scenario registry of the OrangeLine test harness
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#include "harness.hpp"
+
+std::vector<Scenario> &scenarios () {
+	static std::vector<Scenario> registered;
+	return registered;
+}
+
+Scenario *findScenario (const std::string &name) {
+	for (auto &scenario : scenarios ())
+		if (scenario.name == name)
+			return &scenario;
+	return nullptr;
+}
+
+Module *createModule (Scenario &scenario) {
+	Module *module = (*scenario.model)->createModule ();
+	for (auto &output : module->outputs)
+		output.channels = 1;
+	return module;
+}
@@ -0,0 +1,104 @@
+/*
+	harness.hpp
+
+	Headless test harness for OrangeLine modules
+
+	A scenario is a module plus a script setting its params and input voltages sample by sample,
+	like a user and a patch around it would. Each module gets its own driver file registering its scenarios,
+	because the module headers define the same enum names. The golden runner and the benchmark
+	drive the registered scenarios, see Makefile.
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "plugin.hpp"
+
+#define HARNESS_SAMPLE_RATE	44100.f
+#define BUTTON_SAMPLES		512		// Samples a button is held and released, long enough for all skipped samples and param poll slices
+
+/*
+	A script is called before each sample with frame 0, 1, 2, ... and patches, sets params and input voltages.
+	It has to work for any frame, the benchmark runs it longer than the golden runner.
+	Each module instance gets its own script from the scenario, so scripts may keep state,
+	e.g. to play a sequencer answering the module's outputs.
+*/
+typedef std::function<void (Module *module, long frame)> Script;
+typedef std::function<Script ()> ScriptFactory;
+
+struct Scenario {
+	std::string name;
+	Model **model;		// Models are created when the plugin is loaded, so keep a pointer to the pointer
+	long frames;		// Samples to run for the golden file
+	ScriptFactory script;
+};
+
+std::vector<Scenario> &scenarios ();
+
+struct ScenarioRegistration {
+	ScenarioRegistration (const char *name, Model **model, long frames, ScriptFactory script) {
+		scenarios ().push_back (Scenario { name, model, frames, script });
+	}
+};
+
+Scenario *findScenario (const std::string &name);
+
+/**
+	Factory for a script without state, all module instances share it
+*/
+inline ScriptFactory shared (Script script) {
+	return [script] () { return script; };
+}
+
+/*
+	Create a module and connect all its outputs, Rack gives a connected output one channel
+*/
+Module *createModule (Scenario &scenario);
+
+/*
+	Script helpers
+*/
+
+/**
+	Patch a cable into an input with the given number of channels, 0 unpatches it
+*/
+inline void connect (Input &input, int channels = 1) {
+	input.channels = channels;
+}
+
+/**
+	Voltage of a pulse train with the given period, high for the first width samples
+*/
+inline float pulse (long frame, long period, long width = 10) {
+	return frame % period < width ? 10.f : 0.f;
+}
+
+/**
+	Button value when the button is clicked count times starting at frame start
+*/
+inline float button (long frame, int count, long start = 0) {
+	long click = (frame - start) / (2 * BUTTON_SAMPLES);
+	return frame >= start && click < count && (frame - start) % (2 * BUTTON_SAMPLES) < BUTTON_SAMPLES ? 1.f : 0.f;
+}
+
+/**
+	Frame after count button clicks starting at frame start
+*/
+inline long afterButton (int count, long start = 0) {
+	return start + count * 2 * BUTTON_SAMPLES;
+}
@@ -0,0 +1,123 @@
+/*
+	mother.cpp
+
+	Test harness scenarios for the OrangeLine module Mother
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#include "harness.hpp"
+#include "Mother.hpp"
+
+#define MOTHER_CHANNELS	4
+#define MOTHER_SETUP	afterButton (1, BUTTON_SAMPLES)	// Module is initialized and scale is set up
+
+static const int majorNotes[] = { 2, 4, 5, 7, 9, 11 };	// Root is on by default
+
+/**
+	Click the note buttons of the major scale in the first scale once
+*/
+static void setupMajor (Module *module, long frame) {
+	for (int n : majorNotes)
+		module->params[ONOFF_PARAM + n].setValue (button (frame, 1, BUTTON_SAMPLES));
+}
+
+/**
+	Stepped cv per channel, wandering over 3 octaves in steps of 0 to 7 semitones and fractions of them
+*/
+static float motherCv (long frame, int channel) {
+	long step = frame / 100 + channel * 5;
+	return float((step * 29) % 37) / 12.f - 1.f + float(step % 3) * 0.021f;
+}
+
+/*
+	Poly cv sampled by a poly trigger with fate, channels triggered at 20 Hz with different phases
+*/
+static ScenarioRegistration motherTrg ("mother_trg", &modelMother, 44100, shared ([] (Module *module, long frame) {
+	if (frame == 0) {
+		connect (module->inputs[CV_INPUT], MOTHER_CHANNELS);
+		connect (module->inputs[TRG_INPUT], MOTHER_CHANNELS);
+	}
+	setupMajor (module, frame);
+	if (frame == MOTHER_SETUP)
+		module->params[FATE_AMT_PARAM].setValue (1.5f);
+	for (int channel = 0; channel < MOTHER_CHANNELS; channel ++) {
+		module->inputs[CV_INPUT].setVoltage (motherCv (frame, channel), channel);
+		module->inputs[TRG_INPUT].setVoltage (pulse (frame + channel * 331, 2205, 100), channel);
+	}
+}));
+
+/*
+	Cv mode, quantizing 2 channels of cv to D major, no fate
+*/
+static ScenarioRegistration motherCvMode ("mother_cv", &modelMother, 20000, shared ([] (Module *module, long frame) {
+	if (frame == 0) {
+		connect (module->inputs[CV_INPUT], 2);
+		module->params[ROOT_PARAM].setValue (2.f);
+	}
+	setupMajor (module, frame);
+	for (int channel = 0; channel < 2; channel ++)
+		module->inputs[CV_INPUT].setVoltage (motherCv (frame, channel), channel);
+}));
+
+/*
+	Poly SCL, CHLD and ROOT inputs, every channel plays another child with another root.
+	Weights and fate shape are edited while playing, root changes halfway
+*/
+static const float childNotes[] = { 0.f, 4.f / 12.f, 9.f / 12.f };
+#define MOTHER_KEYS_FRAMES	44100
+
+static ScenarioRegistration motherKeys ("mother_keys", &modelMother, MOTHER_KEYS_FRAMES, shared ([] (Module *module, long frame) {
+	if (frame == 0) {
+		connect (module->inputs[CV_INPUT], MOTHER_CHANNELS);
+		connect (module->inputs[TRG_INPUT], MOTHER_CHANNELS);
+		connect (module->inputs[SCL_INPUT]);
+		connect (module->inputs[CHLD_INPUT], 3);
+		connect (module->inputs[ROOT_INPUT], 2);
+		for (int channel = 0; channel < 3; channel ++)
+			module->inputs[CHLD_INPUT].setVoltage (childNotes[channel], channel);
+		module->inputs[ROOT_INPUT].setVoltage (7.f / 12.f, 1);
+	}
+	setupMajor (module, frame);
+	if (frame == MOTHER_SETUP)
+		module->params[FATE_AMT_PARAM].setValue (2.f);
+	if (frame == MOTHER_KEYS_FRAMES / 4) {
+		module->params[WEIGHT_PARAM + 4].setValue (1.f);	// Grab the third
+		module->params[WEIGHT_PARAM + 7].setValue (0.2f);
+	}
+	if (frame == MOTHER_KEYS_FRAMES / 2) {
+		module->inputs[ROOT_INPUT].setVoltage (2.f / 12.f, 1);
+		module->params[FATE_SHP_PARAM].setValue (0.8f);
+	}
+	for (int channel = 0; channel < MOTHER_CHANNELS; channel ++) {
+		module->inputs[CV_INPUT].setVoltage (motherCv (frame, channel), channel);
+		module->inputs[TRG_INPUT].setVoltage (pulse (frame + channel * 331, 2205, 100), channel);
+	}
+}));
+
+/*
+	Random notes seeded per channel by the RND input, no cv input
+*/
+static ScenarioRegistration motherRnd ("mother_rnd", &modelMother, 44100, shared ([] (Module *module, long frame) {
+	if (frame == 0) {
+		connect (module->inputs[TRG_INPUT], MOTHER_CHANNELS);
+		connect (module->inputs[RND_INPUT], MOTHER_CHANNELS);
+	}
+	setupMajor (module, frame);
+	if (frame == MOTHER_SETUP)
+		module->params[FATE_AMT_PARAM].setValue (3.f);
+	for (int channel = 0; channel < MOTHER_CHANNELS; channel ++) {
+		module->inputs[RND_INPUT].setVoltage (float((frame / 4410 + channel) % 3) * 1.234f, channel);
+		module->inputs[TRG_INPUT].setVoltage (pulse (frame + channel * 331, 2205, 100), channel);
+	}
+}));
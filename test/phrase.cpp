@@ -0,0 +1,111 @@
+/*
+	phrase.cpp
+
+	Test harness scenarios for the OrangeLine module Phrase
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#include "harness.hpp"
+#include "Phrase.hpp"
+
+#define SIXTEENTH	5512	// Samples of a 16th note at 120 BPM
+
+/*
+	Phrases of the master sequencer, pattern, length and duration in steps, duration 0 plays the length
+*/
+struct MasterStep {
+	float pattern;
+	int length;
+	int duration;
+};
+
+static const MasterStep masterSteps[] = {
+	{ 1.f, 8, 16 },
+	{ 2.f, 4,  4 },
+	{ 3.f, 6,  0 },
+};
+#define MASTER_STEPS	int(sizeof (masterSteps) / sizeof (masterSteps[0]))
+
+/**
+	Master sequencer playing masterSteps, advances on Phrase's master clock and restarts on its master reset,
+	like a sequencer patched to MASTER RST, MASTER CLK, PTN, LEN and DUR. A clock coinciding with a reset is ignored
+*/
+struct MasterSequencer {
+	int step = 0;
+	dsp::SchmittTrigger rstTrigger, clkTrigger;
+
+	void process (Module *module) {
+		bool rst = rstTrigger.process (module->outputs[MASTER_RST_OUTPUT].getVoltage ());
+		bool clk = clkTrigger.process (module->outputs[MASTER_CLK_OUTPUT].getVoltage ());
+		if (rst)
+			step = 0;
+		else if (clk)
+			step = (step + 1) % MASTER_STEPS;
+		module->inputs[MASTER_PTN_INPUT].setVoltage (masterSteps[step].pattern);
+		module->inputs[MASTER_LEN_INPUT].setVoltage (masterSteps[step].length / 100.f);
+		module->inputs[MASTER_DUR_INPUT].setVoltage (masterSteps[step].duration / 100.f);
+	}
+};
+
+/*
+	16th clock at 120 BPM driving master and slave sequencer, slave patterns of 3 steps
+*/
+static ScenarioRegistration phraseMasterSlave ("phrase_master_slave", &modelPhrase, 64 * SIXTEENTH, [] () {
+	MasterSequencer master;
+	return Script ([master] (Module *module, long frame) mutable {
+		if (frame == 0) {
+			connect (module->inputs[RST_INPUT]);
+			connect (module->inputs[CLK_INPUT]);
+			connect (module->inputs[MASTER_PTN_INPUT]);
+			connect (module->inputs[MASTER_LEN_INPUT]);
+			connect (module->inputs[MASTER_DUR_INPUT]);
+			module->params[LEN_PARAM].setValue (3.f);
+		}
+		master.process (module);
+		module->inputs[RST_INPUT].setVoltage (frame >= 100 && frame < 200 ? 10.f : 0.f);
+		module->inputs[CLK_INPUT].setVoltage (pulse (frame + SIXTEENTH - 1000, SIXTEENTH, 100));
+	});
+});
+
+/*
+	Clock division 2 with master response and slave clock delays, default length from DLEN,
+	slave patterns counting down and a reset while playing
+*/
+static ScenarioRegistration phraseDivDelay ("phrase_div_delay", &modelPhrase, 96 * SIXTEENTH, [] () {
+	MasterSequencer master;
+	return Script ([master] (Module *module, long frame) mutable {
+		if (frame == 0) {
+			connect (module->inputs[RST_INPUT]);
+			connect (module->inputs[CLK_INPUT]);
+			connect (module->inputs[MASTER_PTN_INPUT]);
+			connect (module->inputs[MASTER_LEN_INPUT]);
+			connect (module->inputs[MASTER_DUR_INPUT]);
+			connect (module->inputs[DLEN_INPUT]);
+			connect (module->inputs[PTN_INPUT]);
+			module->inputs[DLEN_INPUT].setVoltage (0.05f);
+			module->inputs[PTN_INPUT].setVoltage (0.5f);
+			module->params[DIV_PARAM].setValue (2.f);
+			module->params[LEN_PARAM].setValue (2.f);
+			module->params[INC_PARAM].setValue (-1.f);
+			module->params[DLY_PARAM].setValue (3.f);
+			module->params[CLK_DLY_PARAM].setValue (5.f);
+		}
+		master.process (module);
+		if (master.step == 2)
+			module->inputs[MASTER_LEN_INPUT].setVoltage (0.f);	// Length from DLEN
+		long rst = frame < 48 * SIXTEENTH ? frame : frame - (48 * SIXTEENTH + 2000);
+		module->inputs[RST_INPUT].setVoltage (rst >= 100 && rst < 200 ? 10.f : 0.f);
+		module->inputs[CLK_INPUT].setVoltage (pulse (frame + SIXTEENTH - 1000, SIXTEENTH, 100));
+	});
+});
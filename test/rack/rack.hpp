@@ -0,0 +1,395 @@
+/*
+	rack.hpp
+
+	Headless stand in for the VCV Rack v1 API used by the OrangeLine test harness
+
+	Covers exactly what the OrangeLine sources use. The engine part (Module, Param, Port, Light, dsp)
+	follows Rack v1 semantics, everything UI related (widgets, nanovg, assets, json) links but does nothing.
+	Lets the harness build the module sources without a Rack SDK and drive modules sample by sample.
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <list>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <cstring>
+#include <cstdio>
+#include <cstdint>
+#include <cmath>
+#include <cassert>
+
+/*
+	jansson, state is never saved or loaded headless
+*/
+typedef struct json_t json_t;
+inline json_t *json_object () { return nullptr; }
+inline int json_object_set_new (json_t *, const char *, json_t *) { return 0; }
+inline json_t *json_real (double) { return nullptr; }
+inline json_t *json_object_get (json_t *, const char *) { return nullptr; }
+inline double json_real_value (json_t *) { return 0.; }
+inline void *json_object_iter (json_t *) { return nullptr; }
+inline void *json_object_iter_next (json_t *, void *) { return nullptr; }
+inline const char *json_object_iter_key (void *) { return nullptr; }
+inline json_t *json_object_iter_value (void *) { return nullptr; }
+inline void *json_object_key_to_iter (const char *) { return nullptr; }
+#define json_object_foreach(object, key, value) \
+	for (key = json_object_iter_key (json_object_iter (object)); \
+		key && (value = json_object_iter_value (json_object_key_to_iter (key))); \
+		key = json_object_iter_key (json_object_iter_next (object, json_object_key_to_iter (key))))
+
+/*
+	nanovg, nothing is drawn headless
+*/
+struct NVGcontext;
+struct NVGcolor { float r, g, b, a; };
+inline NVGcolor nvgRGBA (int r, int g, int b, int a) { return NVGcolor { r / 255.f, g / 255.f, b / 255.f, a / 255.f }; }
+inline NVGcolor nvgRGB (int r, int g, int b) { return nvgRGBA (r, g, b, 255); }
+inline void nvgFontFaceId (NVGcontext *, int) {}
+inline void nvgFontSize (NVGcontext *, float) {}
+inline void nvgFillColor (NVGcontext *, NVGcolor) {}
+inline float nvgText (NVGcontext *, float x, float, const char *, const char *) { return x; }
+inline void nvgBeginPath (NVGcontext *) {}
+inline void nvgCircle (NVGcontext *, float, float, float) {}
+inline void nvgStrokeWidth (NVGcontext *, float) {}
+inline void nvgStrokeColor (NVGcontext *, NVGcolor) {}
+inline void nvgStroke (NVGcontext *) {}
+
+#define RIGHT_ARROW "\xe2\x96\xb8"
+
+namespace rack {
+
+namespace math {
+struct Vec {
+	float x = 0.f, y = 0.f;
+	Vec () {}
+	Vec (float x, float y) : x (x), y (y) {}
+	Vec plus (Vec b) const { return Vec (x + b.x, y + b.y); }
+};
+struct Rect { Vec pos, size; };
+}
+using math::Vec;
+using math::Rect;
+
+inline Vec mm2px (Vec v) { return Vec (v.x * 75.f / 25.4f, v.y * 75.f / 25.4f); }
+inline float mm2px (float v) { return v * 75.f / 25.4f; }
+
+/*
+	dsp, same behavior as Rack v1
+*/
+namespace dsp {
+struct SchmittTrigger {
+	bool state = true;
+	void reset () { state = true; }
+	bool process (float in) {
+		if (state) {
+			if (in <= 0.f)
+				state = false;
+		}
+		else if (in >= 1.f) {
+			state = true;
+			return true;
+		}
+		return false;
+	}
+};
+struct PulseGenerator {
+	float remaining = 0.f;
+	void reset () { remaining = 0.f; }
+	bool process (float deltaTime) {
+		if (remaining > 0.f) {
+			remaining -= deltaTime;
+			return true;
+		}
+		return false;
+	}
+	void trigger (float duration = 1e-3f) {
+		if (duration > remaining)
+			remaining = duration;
+	}
+};
+struct ClockDivider {
+	uint32_t clock = 0, division = 1;
+	void reset () { clock = 0; }
+	void setDivision (uint32_t d) { division = d; }
+	uint32_t getDivision () { return division; }
+	bool process () {
+		if (++ clock >= division) {
+			clock = 0;
+			return true;
+		}
+		return false;
+	}
+};
+}
+
+/*
+	engine, a Port is connected while it has channels, like in Rack v1
+*/
+namespace engine {
+struct Param {
+	float value = 0.f;
+	float getValue () { return value; }
+	void setValue (float v) { value = v; }
+};
+struct Port {
+	float voltages[16] = {};
+	uint8_t channels = 0;
+	bool isConnected () { return channels > 0; }
+	float getVoltage (int channel = 0) { return voltages[channel]; }
+	void setVoltage (float voltage, int channel = 0) { voltages[channel] = voltage; }
+	float *getVoltages () { return voltages; }
+	int getChannels () { return channels; }
+	void setChannels (int c) {
+		if (channels == 0)	// Like Rack, do nothing on a disconnected port
+			return;
+		for (int i = c; i < channels; i ++)
+			voltages[i] = 0.f;
+		channels = c == 0 ? 1 : c;
+	}
+};
+struct Input : Port {};
+struct Output : Port {};
+struct Light {
+	float value = 0.f;
+	void setBrightness (float b) { value = b; }
+	float getBrightness () { return value; }
+};
+struct ParamQuantity {
+	float minValue = 0.f, maxValue = 1.f, defaultValue = 0.f;
+	std::string label, unit;
+};
+struct Module {
+	int id = -1;
+	std::vector<Param> params;
+	std::vector<Input> inputs;
+	std::vector<Output> outputs;
+	std::vector<Light> lights;
+	std::vector<ParamQuantity *> paramQuantities;
+
+	struct ProcessArgs {
+		float sampleRate;
+		float sampleTime;
+	};
+
+	void config (int numParams, int numInputs, int numOutputs, int numLights) {
+		params.resize (numParams);
+		inputs.resize (numInputs);
+		outputs.resize (numOutputs);
+		lights.resize (numLights);
+		paramQuantities.resize (numParams);
+		for (auto &q : paramQuantities)
+			q = new ParamQuantity ();
+	}
+	template <class TParamQuantity = ParamQuantity>
+	void configParam (int paramId, float minValue, float maxValue, float defaultValue, std::string label = "", std::string unit = "", float = 0.f, float = 1.f, float = 0.f) {
+		ParamQuantity *q = paramQuantities[paramId];
+		q->minValue = minValue;
+		q->maxValue = maxValue;
+		q->defaultValue = defaultValue;
+		q->label = label;
+		q->unit = unit;
+		params[paramId].value = defaultValue;
+	}
+	virtual void process (const ProcessArgs &) {}
+	virtual json_t *dataToJson () { return nullptr; }
+	virtual void dataFromJson (json_t *) {}
+	virtual void onReset () {}
+	virtual ~Module () {
+		for (auto q : paramQuantities)
+			delete q;
+	}
+};
+struct Engine {
+	float sampleRate = 44100.f;
+	float getSampleRate () { return sampleRate; }
+};
+}
+using engine::Module;
+using engine::Param;
+using engine::Input;
+using engine::Output;
+using engine::Light;
+using engine::ParamQuantity;
+
+/*
+	plugin, a Model only creates modules, there are no module widgets headless
+*/
+namespace plugin {
+struct Model {
+	std::string slug;
+	virtual engine::Module *createModule () = 0;
+	virtual ~Model () {}
+};
+struct Plugin {
+	std::vector<Model *> models;
+	void addModel (Model *model) { models.push_back (model); }
+};
+}
+using plugin::Plugin;
+using plugin::Model;
+
+struct Font { int handle = -1; };
+struct Svg {};
+
+namespace window {
+struct Window {
+	std::shared_ptr<Font> loadFont (std::string) { return std::make_shared<Font> (); }
+	std::shared_ptr<Svg> loadSvg (std::string) { return std::make_shared<Svg> (); }
+};
+}
+
+namespace event {
+struct Action {};
+struct Enter {};
+}
+
+namespace widget {
+struct Widget {
+	Rect box;
+	bool visible = true;
+	Widget *parent = nullptr;
+	std::list<Widget *> children;
+	struct DrawArgs {
+		NVGcontext *vg;
+		Rect clipBox;
+		void *fb = nullptr;
+	};
+	virtual ~Widget () {
+		for (auto child : children)
+			delete child;
+	}
+	virtual void draw (const DrawArgs &) {}
+	virtual void step () {}
+	virtual void onEnter (const event::Enter &) {}
+	void addChild (Widget *child) { children.push_back (child); child->parent = this; }
+	bool isVisible () { return visible; }
+	void show () { visible = true; }
+	void hide () { visible = false; }
+	Rect getViewport (Rect r = Rect ()) { return r; }
+};
+struct TransparentWidget : Widget {};
+struct FramebufferWidget : Widget {
+	bool dirty = true;
+	void setDirty (bool d = true) { dirty = d; }
+};
+struct SvgWidget : Widget {};
+}
+using widget::Widget;
+using widget::TransparentWidget;
+using widget::FramebufferWidget;
+
+namespace ui { struct Menu; }
+
+namespace app {
+struct SvgPanel : widget::Widget {
+	void setBackground (std::shared_ptr<Svg>) {}
+};
+struct ParamWidget : widget::Widget {};
+struct Knob : ParamWidget { bool snap = false; };
+struct RoundSmallBlackKnob : Knob {};
+struct RoundBlackKnob : Knob {};
+struct RoundLargeBlackKnob : Knob {};
+struct Trimpot : Knob {};
+struct LEDButton : ParamWidget {};
+struct PortWidget : widget::Widget {};
+struct PJ301MPort : PortWidget {};
+struct ModuleLightWidget : widget::Widget { NVGcolor bgColor; };
+struct RedGreenBlueLight : ModuleLightWidget {};
+struct YellowLight : ModuleLightWidget {};
+template <class TBase> struct LargeLight : TBase {};
+struct ModuleWidget : widget::Widget {
+	engine::Module *module = nullptr;
+	void setModule (engine::Module *m) { module = m; }
+	void setPanel (std::shared_ptr<Svg>) {}
+	void addParam (ParamWidget *w) { addChild (w); }
+	void addInput (PortWidget *w) { addChild (w); }
+	void addOutput (PortWidget *w) { addChild (w); }
+	virtual void appendContextMenu (ui::Menu *) {}
+};
+struct App {
+	window::Window *window;
+	engine::Engine *engine;
+};
+}
+using app::SvgPanel;
+using app::ModuleWidget;
+using app::RoundSmallBlackKnob;
+using app::RoundBlackKnob;
+using app::RoundLargeBlackKnob;
+using app::Trimpot;
+using app::LEDButton;
+using app::PJ301MPort;
+using app::RedGreenBlueLight;
+using app::YellowLight;
+using app::LargeLight;
+using app::ParamWidget;
+using app::PortWidget;
+using app::ModuleLightWidget;
+
+namespace ui {
+struct MenuEntry : widget::Widget { void setSize (Vec) {} };
+struct MenuLabel : MenuEntry { std::string text; };
+struct Menu : widget::Widget {};
+struct MenuItem : MenuEntry {
+	std::string text, rightText;
+	bool disabled = false;
+	virtual Menu *createChildMenu () { return nullptr; }
+	virtual void onAction (const event::Action &) {}
+};
+}
+using ui::Menu;
+using ui::MenuItem;
+using ui::MenuLabel;
+
+inline app::App *appGet () {
+	static window::Window window;
+	static engine::Engine engine;
+	static app::App app { &window, &engine };
+	return &app;
+}
+#define APP rack::appGet ()
+
+namespace asset {
+inline std::string plugin (Plugin *, std::string filename) { return filename; }
+inline std::string user (std::string filename) { return filename; }
+}
+
+namespace system {
+inline double getTime () {
+	return std::chrono::duration<double> (std::chrono::steady_clock::now ().time_since_epoch ()).count ();
+}
+}
+
+template <class TParamWidget> TParamWidget *createParamCentered (Vec, engine::Module *, int) { return new TParamWidget; }
+template <class TModuleLightWidget> TModuleLightWidget *createLightCentered (Vec, engine::Module *, int) { return new TModuleLightWidget; }
+template <class TPortWidget> TPortWidget *createInputCentered (Vec, engine::Module *, int) { return new TPortWidget; }
+template <class TPortWidget> TPortWidget *createOutputCentered (Vec, engine::Module *, int) { return new TPortWidget; }
+
+template <class TModule, class TModuleWidget>
+Model *createModel (std::string slug) {
+	struct TModel : Model {
+		engine::Module *createModule () override { return new TModule; }
+	};
+	Model *model = new TModel;
+	model->slug = slug;
+	return model;
+}
+
+}
@@ -0,0 +1,72 @@
+/*
+	swing.cpp
+
+	Test harness scenarios for the OrangeLine module Swing
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#include "harness.hpp"
+#include "Swing.hpp"
+
+#define QUARTER	22050	// Samples of a quarter note at 120 BPM
+
+/**
+	Swing the off beats, pull every fourth step ahead
+*/
+static void setupTiming (Module *module, long frame) {
+	if (frame == 0)
+		for (int i = 0; i < 16; i ++)
+			module->params[TIM_PARAM_01 + i].setValue (i % 4 == 3 ? -25.f : i % 2 ? 50.f : 0.f);
+}
+
+/*
+	Quarter note clock at 120 BPM with BPM input, swung 16th clocks
+*/
+static ScenarioRegistration swingBpm ("swing_bpm", &modelSwing, 4 * QUARTER, shared ([] (Module *module, long frame) {
+	if (frame == 0) {
+		connect (module->inputs[BPM_INPUT]);
+		connect (module->inputs[CLK_INPUT]);
+		module->inputs[BPM_INPUT].setVoltage (0.f);	// 120 BPM
+	}
+	setupTiming (module, frame);
+	module->inputs[CLK_INPUT].setVoltage (pulse (frame, QUARTER, 100));
+}));
+
+/*
+	Clock without BPM input, Swing only follows the clock
+*/
+static ScenarioRegistration swingClk ("swing_clk", &modelSwing, 4 * QUARTER, shared ([] (Module *module, long frame) {
+	if (frame == 0)
+		connect (module->inputs[CLK_INPUT]);
+	setupTiming (module, frame);
+	module->inputs[CLK_INPUT].setVoltage (pulse (frame, QUARTER, 100));
+}));
+
+/*
+	Triplets of a 6 step pattern at 50% amount with BPM input, reset in the middle of a beat
+*/
+static ScenarioRegistration swingBpmRst ("swing_bpm_rst", &modelSwing, 4 * QUARTER, shared ([] (Module *module, long frame) {
+	if (frame == 0) {
+		connect (module->inputs[BPM_INPUT]);
+		connect (module->inputs[CLK_INPUT]);
+		connect (module->inputs[RST_INPUT]);
+		module->inputs[BPM_INPUT].setVoltage (0.f);
+		module->params[DIV_PARAM].setValue (3.f);
+		module->params[LEN_PARAM].setValue (6.f);
+		module->params[AMT_PARAM].setValue (50.f);
+	}
+	setupTiming (module, frame);
+	module->inputs[CLK_INPUT].setVoltage (pulse (frame, QUARTER, 100));
+	module->inputs[RST_INPUT].setVoltage (frame >= 2 * QUARTER + 7000 && frame < 2 * QUARTER + 7100 ? 10.f : 0.f);
+}));